@@ -3,6 +3,7 @@
 
 #include "application.h"
 #include "controller.h"
+#include "startuptrace.h"
 #include "version.h"
 
 #include "vstgui/standalone/include/helpers/preferences.h"
@@ -28,7 +29,11 @@ Application::Application ()
 //------------------------------------------------------------------------
 void Application::finishLaunching ()
 {
-	auto controller = std::make_shared<Controller> ();
+	std::shared_ptr<Controller> controller;
+	{
+		StartupTraceScope traceScope ("Create Controller");
+		controller = std::make_shared<Controller> ();
+	}
 
 	UIDesc::Config config;
 	config.uiDescFileName = "Window.uidesc";
@@ -38,8 +43,14 @@ void Application::finishLaunching ()
 	config.windowConfig.title = "VST3 Project Generator";
 	config.windowConfig.autoSaveFrameName = "MainWindow";
 	config.windowConfig.style.border ().close ().centered ().size ();
-	if (auto window = UIDesc::makeWindow (config))
+	WindowPtr window;
+	{
+		StartupTraceScope traceScope ("UIDesc::makeWindow");
+		window = UIDesc::makeWindow (config);
+	}
+	if (window)
 	{
+		StartupTraceScope traceScope ("Show Window");
 		window->show ();
 		window->registerWindowListener (this);
 	}
@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#include "buildtimings.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+namespace {
+
+constexpr auto NinjaLogFileName = ".ninja_log";
+constexpr auto BuiltTargetMarker = "Built target ";
+constexpr auto TargetDirectoryMarker = "CMakeFiles/";
+constexpr auto TargetDirectorySuffix = ".dir/";
+constexpr auto OtherStepsName = "(link and custom steps)";
+
+//------------------------------------------------------------------------
+std::string makeNinjaLogPath (const std::string& buildDir)
+{
+	auto path = buildDir;
+	if (!path.empty () && *path.rbegin () != '/' && *path.rbegin () != '\\')
+		path += '/';
+	return path + NinjaLogFileName;
+}
+
+//------------------------------------------------------------------------
+int64_t getFileSize (const std::string& path)
+{
+	std::ifstream stream (path, std::ios::in | std::ios::binary | std::ios::ate);
+	if (!stream.is_open ())
+		return -1;
+	return static_cast<int64_t> (stream.tellg ());
+}
+
+//------------------------------------------------------------------------
+/** object files are written to .../CMakeFiles/<target>.dir/... */
+std::string targetNameFromOutput (const std::string& output)
+{
+	auto start = output.rfind (TargetDirectoryMarker);
+	if (start == std::string::npos)
+		return OtherStepsName;
+	start += strlen (TargetDirectoryMarker);
+	auto end = output.find (TargetDirectorySuffix, start);
+	if (end == std::string::npos)
+		return OtherStepsName;
+	return output.substr (start, end - start);
+}
+
+//------------------------------------------------------------------------
+std::string formatSeconds (double seconds)
+{
+	char buffer[32];
+	snprintf (buffer, sizeof (buffer), "%.1f s", seconds);
+	return buffer;
+}
+
+//------------------------------------------------------------------------
+void appendTargetTimes (std::string& report, const BuildTimings::TargetTimes& times)
+{
+	size_t nameWidth = 0;
+	for (const auto& time : times)
+		nameWidth = std::max (nameWidth, time.name.size ());
+	for (const auto& time : times)
+	{
+		report += "  " + time.name + std::string (nameWidth - time.name.size () + 2, ' ');
+		report += formatSeconds (time.seconds) + "\n";
+	}
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+void BuildTimings::start (const std::string& dir)
+{
+	buildDir = dir;
+	ninjaLogOffset = getFileSize (makeNinjaLogPath (buildDir));
+	if (ninjaLogOffset < 0)
+		ninjaLogOffset = 0;
+	pendingLine.clear ();
+	finishedTargets.clear ();
+	startTime = Clock::now ();
+}
+
+//------------------------------------------------------------------------
+void BuildTimings::onOutput (const char* data, size_t size)
+{
+	for (auto end = data + size; data != end; ++data)
+	{
+		if (*data == '\n' || *data == '\r')
+		{
+			if (!pendingLine.empty ())
+				onOutputLine (pendingLine);
+			pendingLine.clear ();
+		}
+		else
+			pendingLine += *data;
+	}
+}
+
+//------------------------------------------------------------------------
+void BuildTimings::onOutputLine (const std::string& line)
+{
+	auto pos = line.find (BuiltTargetMarker);
+	if (pos == std::string::npos)
+		return;
+	std::chrono::duration<double> elapsed = Clock::now () - startTime;
+	finishedTargets.push_back ({line.substr (pos + strlen (BuiltTargetMarker)), elapsed.count ()});
+}
+
+//------------------------------------------------------------------------
+std::string BuildTimings::finish ()
+{
+	if (!pendingLine.empty ())
+		onOutputLine (pendingLine);
+	pendingLine.clear ();
+
+	std::chrono::duration<double> elapsed = Clock::now () - startTime;
+	std::string report = "\nBuild time: " + formatSeconds (elapsed.count ()) + "\n";
+
+	TargetTimes ninjaTimes;
+	if (parseNinjaLog (makeNinjaLogPath (buildDir), ninjaLogOffset, ninjaTimes) &&
+	    !ninjaTimes.empty ())
+	{
+		report += "Time spent in the build steps of each target:\n";
+		appendTargetTimes (report, ninjaTimes);
+	}
+	else if (!finishedTargets.empty ())
+	{
+		report += "Targets finished after:\n";
+		appendTargetTimes (report, finishedTargets);
+	}
+	return report;
+}
+
+//------------------------------------------------------------------------
+bool BuildTimings::parseNinjaLog (const std::string& path, int64_t offset, TargetTimes& result)
+{
+	std::ifstream stream (path, std::ios::in | std::ios::binary);
+	if (!stream.is_open ())
+		return false;
+	stream.seekg (0, std::ios::end);
+	// ninja recompacts the log from time to time, the offset is useless then
+	if (static_cast<int64_t> (stream.tellg ()) < offset)
+		offset = 0;
+	stream.seekg (offset);
+
+	// <start ms>\t<end ms>\t<mtime>\t<output>\t<command hash>
+	std::map<std::string, int64_t> milliseconds;
+	std::string line;
+	while (std::getline (stream, line))
+	{
+		if (line.empty () || line[0] == '#')
+			continue;
+		char* pos = nullptr;
+		auto startTime = std::strtoll (line.data (), &pos, 10);
+		auto endTime = std::strtoll (pos, &pos, 10);
+		auto outputStart = line.find ('\t', line.find ('\t', line.find ('\t') + 1) + 1);
+		if (outputStart == std::string::npos)
+			continue;
+		auto outputEnd = line.find ('\t', outputStart + 1);
+		auto output = line.substr (outputStart + 1, outputEnd - outputStart - 1);
+		milliseconds[targetNameFromOutput (output)] += endTime - startTime;
+	}
+
+	result.clear ();
+	for (const auto& entry : milliseconds)
+		result.push_back ({entry.first, static_cast<double> (entry.second) / 1000.});
+	std::sort (result.begin (), result.end (),
+	           [] (const auto& lhs, const auto& rhs) { return lhs.seconds > rhs.seconds; });
+	return true;
+}
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
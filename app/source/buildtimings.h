@@ -0,0 +1,57 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+/** Measures a "cmake --build" run and reports the total and the per target build times.
+ *
+ *	For Ninja builds the per target times are the summed durations of the build steps of the
+ *	target taken from the .ninja_log entries added by this build. For other generators only the
+ *	time when a target was finished is known, it is taken from the "Built target" lines of the
+ *	build output.
+ */
+class BuildTimings
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	void start (const std::string& buildDir);
+	void onOutput (const char* data, size_t size);
+	/** returns the report */
+	std::string finish ();
+
+	struct TargetTime
+	{
+		std::string name;
+		double seconds {0.};
+	};
+	using TargetTimes = std::vector<TargetTime>;
+
+	/** sums the durations of the build steps of the .ninja_log lines after offset per target */
+	static bool parseNinjaLog (const std::string& path, int64_t offset, TargetTimes& result);
+
+private:
+	void onOutputLine (const std::string& line);
+
+	Clock::time_point startTime;
+	std::string buildDir;
+	int64_t ninjaLogOffset {-1};
+	std::string pendingLine;
+	TargetTimes finishedTargets;
+};
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
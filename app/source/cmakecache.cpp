@@ -0,0 +1,74 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#include "cmakecache.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+VSTGUI::Optional<CMakeCacheEntries> readCMakeCache (const std::string& buildDir)
+{
+	auto path = buildDir;
+	if (!path.empty () && *path.rbegin () != '/' && *path.rbegin () != '\\')
+		path += '/';
+	path += "CMakeCache.txt";
+
+	std::ifstream stream (path);
+	if (!stream.is_open ())
+		return {};
+
+	CMakeCacheEntries entries;
+	std::string line;
+	while (std::getline (stream, line))
+	{
+		if (!line.empty () && *line.rbegin () == '\r')
+			line.pop_back ();
+		if (line.empty () || line[0] == '#' || line.compare (0, 2, "//") == 0)
+			continue;
+		// <name>:<type>=<value>
+		auto equal = line.find ('=');
+		if (equal == std::string::npos)
+			continue;
+		auto colon = line.rfind (':', equal);
+		auto nameEnd = colon == std::string::npos ? equal : colon;
+		entries[line.substr (0, nameEnd)] = line.substr (equal + 1);
+	}
+	return {std::move (entries)};
+}
+
+//------------------------------------------------------------------------
+const std::string& getCMakeCacheValue (const CMakeCacheEntries& entries, const std::string& key)
+{
+	static const std::string empty;
+	auto it = entries.find (key);
+	return it == entries.end () ? empty : it->second;
+}
+
+//------------------------------------------------------------------------
+bool isCMakeTrue (const std::string& value)
+{
+	auto upper = value;
+	std::transform (upper.begin (), upper.end (), upper.begin (), [] (char c) {
+		return static_cast<char> (toupper (static_cast<unsigned char> (c)));
+	});
+	if (upper == "ON" || upper == "YES" || upper == "TRUE" || upper == "Y")
+		return true;
+	if (upper.empty ())
+		return false;
+	char* end = nullptr;
+	auto number = strtod (upper.data (), &end);
+	return *end == 0 && number != 0.;
+}
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
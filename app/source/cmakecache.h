@@ -0,0 +1,32 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#pragma once
+
+#include "vstgui/lib/optional.h"
+#include <string>
+#include <unordered_map>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+/** The entries of the CMakeCache.txt of a build folder, the value type is dropped. */
+using CMakeCacheEntries = std::unordered_map<std::string, std::string>;
+
+//------------------------------------------------------------------------
+/** reads <buildDir>/CMakeCache.txt, no value if the folder was not configured yet */
+VSTGUI::Optional<CMakeCacheEntries> readCMakeCache (const std::string& buildDir);
+
+/** returns the value of the entry or an empty string */
+const std::string& getCMakeCacheValue (const CMakeCacheEntries& entries, const std::string& key);
+
+/** evaluates a cache value like the if() command of cmake does for a constant */
+bool isCMakeTrue (const std::string& value);
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
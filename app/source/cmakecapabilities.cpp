@@ -3,12 +3,75 @@
 
 #include "cmakecapabilities.h"
 #include "include/rapidjson/document.h"
+#include "vstgui/lib/vstguibase.h"
+
+#include <algorithm>
 
 //------------------------------------------------------------------------
 namespace Steinberg {
 namespace Vst {
 namespace ProjectCreator {
 
+//------------------------------------------------------------------------
+namespace {
+
+constexpr auto DefaultPlatformName = "Defaults";
+
+//------------------------------------------------------------------------
+bool isGeneratorUsable (const GeneratorCapabilites& generator)
+{
+#if WINDOWS
+	// the old Visual Studio generator names with the architecture in the name are superseded by
+	// the platform selection
+	const auto& name = generator.name.getString ();
+	return name.find ("Win64") == std::string::npos && name.find ("ARM") == std::string::npos &&
+	       name.find ("IA64") == std::string::npos;
+#else
+	return true;
+#endif // WINDOWS
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+void CMakeGeneratorIndex::build (const std::vector<GeneratorCapabilites>& generators)
+{
+	generatorNames.clear ();
+	platformLists.clear ();
+	platformListIndex.clear ();
+	platformListIndex.reserve (generators.size ());
+
+	for (const auto& generator : generators)
+	{
+		if (!isGeneratorUsable (generator))
+			continue;
+		generatorNames.emplace_back (generator.name);
+
+		StringList platforms;
+		platforms.reserve (generator.platforms.size () + 1);
+		platforms.emplace_back (DefaultPlatformName);
+		platforms.insert (platforms.end (), generator.platforms.begin (),
+		                  generator.platforms.end ());
+
+		auto it = std::find (platformLists.begin (), platformLists.end (), platforms);
+		if (it == platformLists.end ())
+			it = platformLists.emplace (platformLists.end (), std::move (platforms));
+		platformListIndex.emplace (generator.name.getString (),
+		                           static_cast<size_t> (it - platformLists.begin ()));
+	}
+}
+
+//------------------------------------------------------------------------
+auto CMakeGeneratorIndex::findPlatforms (const std::string& generatorName) const
+    -> const StringList*
+{
+	auto it = platformListIndex.find (generatorName);
+	if (it == platformListIndex.end ())
+		return nullptr;
+	return &platformLists[it->second];
+}
+
 //------------------------------------------------------------------------
 auto parseCMakeCapabilities (const std::string& capabilitesJSON)
     -> VSTGUI::Optional<CMakeCapabilites>
@@ -74,6 +137,7 @@ auto parseCMakeCapabilities (const std::string& capabilitesJSON)
 		           [] (const auto& lhs, const auto& rhs) {
 			           return lhs.name.getString () > rhs.name.getString ();
 		           });
+		cap.generatorIndex.build (cap.generators);
 	}
 	catch (...)
 	{
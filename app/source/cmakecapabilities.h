@@ -5,6 +5,8 @@
 
 #include "vstgui/lib/cstring.h"
 #include "vstgui/lib/optional.h"
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 //------------------------------------------------------------------------
@@ -20,6 +22,30 @@ struct GeneratorCapabilites
 	std::vector<VSTGUI::UTF8String> platforms;
 };
 
+/** Lookup structure for the generators, built once when the capabilities are parsed.
+ *
+ *	The string lists are prepared in the form the UI shows them, generators with the same
+ *	platforms share one list.
+ */
+class CMakeGeneratorIndex
+{
+public:
+	using StringList = std::vector<VSTGUI::UTF8String>;
+
+	void build (const std::vector<GeneratorCapabilites>& generators);
+
+	/** the generators usable on this platform */
+	const StringList& getGeneratorNames () const { return generatorNames; }
+	/** the platforms of the generator with "Defaults" as first entry, nullptr if unknown */
+	const StringList* findPlatforms (const std::string& generatorName) const;
+
+private:
+	StringList generatorNames;
+	std::vector<StringList> platformLists;
+	std::unordered_map<std::string, size_t> platformListIndex;
+};
+
+//------------------------------------------------------------------------
 struct CMakeCapabilites
 {
 	int32_t versionMajor {0};
@@ -27,6 +53,7 @@ struct CMakeCapabilites
 	int32_t versionPatch {0};
 
 	std::vector<GeneratorCapabilites> generators;
+	CMakeGeneratorIndex generatorIndex;
 };
 
 //------------------------------------------------------------------------
@@ -0,0 +1,306 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#include "cmakediscovery.h"
+#include "filesystem.h"
+#include "vstgui/lib/vstguibase.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+#if WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+namespace {
+
+// the generated projects and the generator script need at least this version
+constexpr CMakeVersion MinimumSuitableVersion {3, 14, 0};
+
+// most of the time is spent waiting for the file system, so more threads than cores are fine,
+// but we do not want to start a thread for each entry of a long PATH
+constexpr size_t MaxProbeThreads = 8;
+
+constexpr auto CMakeDataDirectoryPrefix = "cmake-";
+
+// the cache is stored as a single preference value, the paths are stored with their length as
+// they may contain the separators
+constexpr auto CacheEntrySeparator = ';';
+constexpr auto CacheFieldSeparator = '|';
+
+#if WINDOWS
+//------------------------------------------------------------------------
+bool isExecutableFile (const std::string& path)
+{
+	auto attributes = GetFileAttributesW (toWideString (path).data ());
+	return attributes != INVALID_FILE_ATTRIBUTES && !(attributes & FILE_ATTRIBUTE_DIRECTORY);
+}
+
+//------------------------------------------------------------------------
+std::string resolvePath (const std::string& path)
+{
+	wchar_t buffer[MAX_PATH];
+	if (GetFullPathNameW (toWideString (path).data (), MAX_PATH, buffer, nullptr) == 0)
+		return path;
+	return toUTF8String (buffer);
+}
+
+#else
+//------------------------------------------------------------------------
+bool isExecutableFile (const std::string& path)
+{
+	if (faccessat (AT_FDCWD, path.data (), X_OK, AT_EACCESS) != 0)
+		return false;
+	struct stat status;
+	return stat (path.data (), &status) == 0 && S_ISREG (status.st_mode);
+}
+
+//------------------------------------------------------------------------
+std::string resolvePath (const std::string& path)
+{
+	char buffer[PATH_MAX];
+	if (!realpath (path.data (), buffer))
+		return path;
+	return buffer;
+}
+#endif
+
+//------------------------------------------------------------------------
+std::string parentDirectory (const std::string& path)
+{
+	auto pos = path.find_last_of (PathDelimiter);
+	if (pos == std::string::npos || pos == 0)
+		return {};
+	return path.substr (0, pos);
+}
+
+//------------------------------------------------------------------------
+bool parseVersion (const std::string& str, CMakeVersion& version)
+{
+	CMakeVersion result;
+	char separator1 = 0;
+	char separator2 = 0;
+	std::istringstream input (str);
+	input >> result.major >> separator1 >> result.minor;
+	if (!input || separator1 != '.')
+		return false;
+	if (input >> separator2 >> result.patch)
+	{
+		if (separator2 != '.')
+			return false;
+	}
+	else
+		result.patch = 0;
+	version = result;
+	return true;
+}
+
+//------------------------------------------------------------------------
+/** cmake installations contain their modules in <prefix>/share/cmake-<major>.<minor> */
+CMakeVersion versionFromDataDirectory (const std::string& resolvedExecutablePath)
+{
+	CMakeVersion result;
+	auto prefix = parentDirectory (parentDirectory (resolvedExecutablePath));
+	if (prefix.empty ())
+		return result;
+	iterateDirectory (prefix + PathDelimiter + "share", [&] (const std::string& name, bool) {
+		if (name.compare (0, strlen (CMakeDataDirectoryPrefix), CMakeDataDirectoryPrefix) != 0)
+			return;
+		CMakeVersion version;
+		if (parseVersion (name.substr (strlen (CMakeDataDirectoryPrefix)), version) &&
+		    result < version)
+			result = version;
+	});
+	return result;
+}
+
+//------------------------------------------------------------------------
+struct Probe
+{
+	bool found {false};
+	std::string resolvedPath;
+	CMakeInstallation installation;
+};
+
+//------------------------------------------------------------------------
+void probeDirectory (const std::string& directory, const char* executableName,
+                     const CMakeVersionCache& versionCache, Probe& probe)
+{
+	auto path = directory;
+	if (!path.empty () && *path.rbegin () != PathDelimiter)
+		path += PathDelimiter;
+	path += executableName;
+	if (!isExecutableFile (path))
+		return;
+
+	probe.found = true;
+	probe.resolvedPath = resolvePath (path);
+	probe.installation.modificationTime = getFileModificationTime (probe.resolvedPath);
+	if (!versionCache.lookup (path, probe.installation.modificationTime,
+	                          probe.installation.version))
+		probe.installation.version = versionFromDataDirectory (probe.resolvedPath);
+	probe.installation.path = std::move (path);
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+bool CMakeVersion::operator< (const CMakeVersion& other) const
+{
+	if (major != other.major)
+		return major < other.major;
+	if (minor != other.minor)
+		return minor < other.minor;
+	return patch < other.patch;
+}
+
+//------------------------------------------------------------------------
+void CMakeVersionCache::restore (const std::string& serialized)
+{
+	entries.clear ();
+	size_t pos = 0;
+	while (pos < serialized.size ())
+	{
+		// <modification time>|<version>|<path length>|<path>;
+		std::string fields[3];
+		for (auto& field : fields)
+		{
+			auto end = serialized.find (CacheFieldSeparator, pos);
+			if (end == std::string::npos)
+				return;
+			field = serialized.substr (pos, end - pos);
+			pos = end + 1;
+		}
+		if (fields[2].empty () ||
+		    fields[2].find_first_not_of ("0123456789") != std::string::npos)
+			return;
+		auto length = static_cast<size_t> (std::strtoull (fields[2].data (), nullptr, 10));
+		if (length >= serialized.size () - pos || serialized[pos + length] != CacheEntrySeparator)
+			return;
+		CMakeInstallation entry;
+		entry.modificationTime = std::strtoll (fields[0].data (), nullptr, 10);
+		entry.path = serialized.substr (pos, length);
+		pos += length + 1;
+		if (!parseVersion (fields[1], entry.version))
+			continue;
+		entries.emplace_back (std::move (entry));
+	}
+}
+
+//------------------------------------------------------------------------
+std::string CMakeVersionCache::serialize () const
+{
+	std::string result;
+	for (const auto& entry : entries)
+	{
+		result += std::to_string (entry.modificationTime) + CacheFieldSeparator;
+		result += std::to_string (entry.version.major) + '.' +
+		          std::to_string (entry.version.minor) + '.' +
+		          std::to_string (entry.version.patch) + CacheFieldSeparator;
+		result += std::to_string (entry.path.size ()) + CacheFieldSeparator;
+		result += entry.path + CacheEntrySeparator;
+	}
+	return result;
+}
+
+//------------------------------------------------------------------------
+bool CMakeVersionCache::lookup (const std::string& path, int64_t modificationTime,
+                                CMakeVersion& version) const
+{
+	auto it = std::find_if (entries.begin (), entries.end (),
+	                        [&] (const auto& entry) { return entry.path == path; });
+	if (it == entries.end () || it->modificationTime != modificationTime)
+		return false;
+	version = it->version;
+	return true;
+}
+
+//------------------------------------------------------------------------
+void CMakeVersionCache::store (const std::string& path, int64_t modificationTime,
+                               const CMakeVersion& version)
+{
+	auto it = std::find_if (entries.begin (), entries.end (),
+	                        [&] (const auto& entry) { return entry.path == path; });
+	if (it == entries.end ())
+		it = entries.emplace (entries.end ());
+	it->path = path;
+	it->modificationTime = modificationTime;
+	it->version = version;
+}
+
+//------------------------------------------------------------------------
+CMakeInstallationList findCMakeInstallations (const std::vector<std::string>& directories,
+                                              const char* executableName,
+                                              const CMakeVersionCache& versionCache)
+{
+	std::vector<Probe> probes (directories.size ());
+	std::atomic<size_t> nextIndex {0};
+	auto worker = [&] () {
+		size_t index;
+		while ((index = nextIndex++) < directories.size ())
+			probeDirectory (directories[index], executableName, versionCache, probes[index]);
+	};
+
+	auto numThreads = std::min<size_t> (std::max (1u, std::thread::hardware_concurrency ()),
+	                                    MaxProbeThreads);
+	numThreads = std::min (numThreads, directories.size ());
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < numThreads; ++i)
+		threads.emplace_back (worker);
+	worker ();
+	for (auto& thread : threads)
+		thread.join ();
+
+	CMakeInstallationList result;
+	std::vector<std::string> resolvedPaths;
+	for (auto& probe : probes)
+	{
+		if (!probe.found || std::find (resolvedPaths.begin (), resolvedPaths.end (),
+		                               probe.resolvedPath) != resolvedPaths.end ())
+			continue;
+		resolvedPaths.emplace_back (std::move (probe.resolvedPath));
+		result.emplace_back (std::move (probe.installation));
+	}
+	return result;
+}
+
+//------------------------------------------------------------------------
+const CMakeInstallation* selectCMakeInstallation (const CMakeInstallationList& installations)
+{
+	if (installations.empty ())
+		return nullptr;
+	const CMakeInstallation* result = nullptr;
+	for (const auto& installation : installations)
+	{
+		if (installation.version < MinimumSuitableVersion)
+			continue;
+		if (!result || result->version < installation.version)
+			result = &installation;
+	}
+	if (result)
+		return result;
+	// no suitable version known, prefer the one found first as the user's PATH order suggests
+	return &installations.front ();
+}
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
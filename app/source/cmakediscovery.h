@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+struct CMakeVersion
+{
+	int32_t major {0};
+	int32_t minor {0};
+	int32_t patch {0};
+
+	bool isKnown () const { return major != 0; }
+	bool operator< (const CMakeVersion& other) const;
+};
+
+//------------------------------------------------------------------------
+struct CMakeInstallation
+{
+	std::string path;
+	int64_t modificationTime {0};
+	CMakeVersion version;
+};
+
+using CMakeInstallationList = std::vector<CMakeInstallation>;
+
+//------------------------------------------------------------------------
+/** Remembers the versions of cmake executables reported by their capabilities.
+ *
+ *	An entry is only valid as long as the modification time of the executable does not change.
+ */
+class CMakeVersionCache
+{
+public:
+	void restore (const std::string& serialized);
+	std::string serialize () const;
+
+	bool lookup (const std::string& path, int64_t modificationTime, CMakeVersion& version) const;
+	void store (const std::string& path, int64_t modificationTime, const CMakeVersion& version);
+
+private:
+	std::vector<CMakeInstallation> entries;
+};
+
+//------------------------------------------------------------------------
+/** Probes all directories concurrently for a cmake executable.
+ *
+ *	The result is in the order of the directories, duplicates (e.g. symlinks to the same
+ *	executable) are removed. The version is taken from the cache or when not found there from the
+ *	name of the cmake data directory of the installation.
+ */
+CMakeInstallationList findCMakeInstallations (const std::vector<std::string>& directories,
+                                              const char* executableName,
+                                              const CMakeVersionCache& versionCache);
+
+/** returns the newest installation which is suitable for generating projects, if no version is
+ *	known the first one found */
+const CMakeInstallation* selectCMakeInstallation (const CMakeInstallationList& installations);
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#include "compilercache.h"
+#include "include/rapidjson/document.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+namespace {
+
+//------------------------------------------------------------------------
+std::string getProgramName (const std::string& programPath)
+{
+	auto pos = programPath.find_last_of ("/\\");
+	auto name = pos == std::string::npos ? programPath : programPath.substr (pos + 1);
+	for (auto& c : name)
+		c = static_cast<char> (std::tolower (static_cast<unsigned char> (c)));
+	auto extension = name.rfind (".exe");
+	if (extension != std::string::npos && extension == name.size () - 4)
+		name.resize (extension);
+	return name;
+}
+
+//------------------------------------------------------------------------
+/** ccache 4 prints one "<counter id>\t<value>" line per counter with --print-stats */
+CompilerCacheStats parseCCacheStats (const std::string& output)
+{
+	CompilerCacheStats stats;
+	std::istringstream input (output);
+	std::string line;
+	while (std::getline (input, line))
+	{
+		auto tab = line.find ('\t');
+		if (tab == std::string::npos)
+			continue;
+		auto id = line.substr (0, tab);
+		auto value = std::strtoll (line.data () + tab + 1, nullptr, 10);
+		if (id == "direct_cache_hit" || id == "preprocessed_cache_hit")
+		{
+			stats.hits += value;
+			stats.valid = true;
+		}
+		else if (id == "cache_miss")
+		{
+			stats.misses += value;
+			stats.valid = true;
+		}
+	}
+	return stats;
+}
+
+//------------------------------------------------------------------------
+int64_t sumCounts (const rapidjson::Value& stats, const char* name)
+{
+	int64_t sum = 0;
+	auto it = stats.FindMember (name);
+	if (it == stats.MemberEnd () || !it->value.IsObject ())
+		return sum;
+	auto counts = it->value.FindMember ("counts");
+	if (counts == it->value.MemberEnd () || !counts->value.IsObject ())
+		return sum;
+	for (const auto& count : counts->value.GetObject ())
+	{
+		if (count.value.IsInt64 ())
+			sum += count.value.GetInt64 ();
+	}
+	return sum;
+}
+
+//------------------------------------------------------------------------
+/** sccache prints {"stats": {"cache_hits": {"counts": {"<language>": n}}, ...}} */
+CompilerCacheStats parseSCCacheStats (const std::string& output)
+{
+	CompilerCacheStats stats;
+	rapidjson::Document doc;
+	doc.Parse (output.data (), output.size ());
+	if (!doc.IsObject ())
+		return stats;
+	auto it = doc.FindMember ("stats");
+	if (it == doc.MemberEnd () || !it->value.IsObject ())
+		return stats;
+	stats.hits = sumCounts (it->value, "cache_hits");
+	stats.misses = sumCounts (it->value, "cache_misses");
+	stats.valid = true;
+	return stats;
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+CompilerCacheType getCompilerCacheType (const std::string& programPath)
+{
+	auto name = getProgramName (programPath);
+	if (name == "ccache")
+		return CompilerCacheType::CCache;
+	if (name == "sccache")
+		return CompilerCacheType::SCCache;
+	return CompilerCacheType::Unknown;
+}
+
+//------------------------------------------------------------------------
+Process::ArgumentList makeCompilerCacheStatsArguments (CompilerCacheType type)
+{
+	Process::ArgumentList args;
+	switch (type)
+	{
+		case CompilerCacheType::CCache:
+		{
+			args.add ("--print-stats");
+			break;
+		}
+		case CompilerCacheType::SCCache:
+		{
+			args.add ("--show-stats");
+			args.add ("--stats-format=json");
+			break;
+		}
+		case CompilerCacheType::Unknown: break;
+	}
+	return args;
+}
+
+//------------------------------------------------------------------------
+CompilerCacheStats parseCompilerCacheStats (CompilerCacheType type, const std::string& output)
+{
+	switch (type)
+	{
+		case CompilerCacheType::CCache: return parseCCacheStats (output);
+		case CompilerCacheType::SCCache: return parseSCCacheStats (output);
+		case CompilerCacheType::Unknown: break;
+	}
+	return {};
+}
+
+//------------------------------------------------------------------------
+std::string makeCompilerCacheReport (const CompilerCacheStats& before,
+                                     const CompilerCacheStats& after)
+{
+	if (!before.valid || !after.valid)
+		return {};
+	auto hits = after.hits - before.hits;
+	auto misses = after.misses - before.misses;
+	// the statistics were reset or other builds used the cache at the same time
+	if (hits < 0 || misses < 0)
+		return {};
+	std::string report = "Compiler cache: " + std::to_string (hits) + " hits, " +
+	                     std::to_string (misses) + " misses";
+	if (hits + misses > 0)
+	{
+		char rate[32];
+		snprintf (rate, sizeof (rate), " (%.1f %% hit rate)",
+		          100. * static_cast<double> (hits) / static_cast<double> (hits + misses));
+		report += rate;
+	}
+	return report + "\n";
+}
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
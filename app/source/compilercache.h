@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#pragma once
+
+#include "process.h"
+#include <cstdint>
+#include <string>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+/** The compiler caches the generated projects can use as compiler launcher. */
+enum class CompilerCacheType
+{
+	Unknown,
+	CCache,
+	SCCache,
+};
+
+//------------------------------------------------------------------------
+/** The statistics of a compiler cache, they are counted over all builds using the cache. */
+struct CompilerCacheStats
+{
+	bool valid {false};
+	int64_t hits {0};
+	int64_t misses {0};
+};
+
+//------------------------------------------------------------------------
+/** determines the type of the compiler cache from the file name of the program */
+CompilerCacheType getCompilerCacheType (const std::string& programPath);
+
+/** the arguments to let the compiler cache print its statistics in a parseable format */
+Process::ArgumentList makeCompilerCacheStatsArguments (CompilerCacheType type);
+
+/** parses the output of the program run with makeCompilerCacheStatsArguments */
+CompilerCacheStats parseCompilerCacheStats (CompilerCacheType type, const std::string& output);
+
+/** the hits and misses between the two statistics, empty if one of them is not valid */
+std::string makeCompilerCacheReport (const CompilerCacheStats& before,
+                                     const CompilerCacheStats& after);
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
@@ -2,10 +2,16 @@
 // Flags       : clang-format SMTGSequencer
 
 #include "controller.h"
+#include "cmakecache.h"
+#include "cmakediscovery.h"
 #include "dimmviewcontroller.h"
+#include "filesystem.h"
+#include "generatorbenchmark.h"
 #include "linkcontroller.h"
 #include "process.h"
 #include "scriptscrollviewcontroller.h"
+#include "startuptrace.h"
+#include "timetrace.h"
 #include "version.h"
 
 #include "vstgui/lib/controls/ctextedit.h"
@@ -20,9 +26,13 @@
 #include "vstgui/standalone/include/icommondirectories.h"
 #include "vstgui/uidescription/cstream.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <ctime>
 #include <fstream>
+#include <memory>
+#include <thread>
 
 //------------------------------------------------------------------------
 namespace Steinberg {
@@ -58,6 +68,18 @@ constexpr auto valueIdWelcomeLocateCMake = "Welcome Locate CMake";
 constexpr auto valueIdValidVSTSDKPath = "Valid VST SDK Path";
 constexpr auto valueIdValidCMakePath = "Valid CMake Path";
 
+//------------------------------------------------------------------------
+constexpr auto preferenceIdCMakeVersionCache = "CMake Version Cache";
+
+//------------------------------------------------------------------------
+constexpr auto VSTSDKIndexCacheFileName = "vstsdkindex.json";
+constexpr auto GeneratorBenchmarkFolderName = "GeneratorBenchmark";
+constexpr auto GeneratorBenchmarkResultsFileName = "generatorbenchmark.csv";
+
+//------------------------------------------------------------------------
+constexpr uint32_t MaxBuildJobs = 1024;
+constexpr size_t MaxTimeTraceReportEntries = 10;
+
 //------------------------------------------------------------------------
 const std::initializer_list<IStringListValue::StringType> pluginTypeDisplayStrings = {
     "Audio Effect", "Instrument"};
@@ -74,6 +96,19 @@ void showSimpleAlert (const char* headline, const char* description)
 	IApplication::instance ().showAlertBoxForWindow (config);
 }
 
+//------------------------------------------------------------------------
+std::string makeInvalidVSTSDKDescription (const VSTSDKIndex& index)
+{
+	if (index.version.empty ())
+		return "The selected folder does not look like the root folder of the VST SDK.";
+	std::string description = "The VST SDK " + index.version +
+	                          " is incomplete, the following files are missing:\n";
+	for (const auto& file : index.missingFiles)
+		description += "\n" + file;
+	description += "\n\nIf you cloned the SDK, make sure the git submodules are checked out.";
+	return description;
+}
+
 //------------------------------------------------------------------------
 size_t makeValidCppName (std::string& str, char replaceChar = '_')
 {
@@ -117,6 +152,102 @@ void setPreferenceStringValue (Preferences& prefs, const UTF8String& key, const
 		prefs.set (key, value->getConverter ().valueAsString (value->getValue ()));
 }
 
+//------------------------------------------------------------------------
+void setPreferenceBoolValue (Preferences& prefs, const UTF8String& key, const ValuePtr& value)
+{
+	if (value)
+		prefs.set (key, value->getValue () > 0.5 ? "1" : "0");
+}
+
+//------------------------------------------------------------------------
+bool getPreferenceBoolValue (Preferences& prefs, const UTF8String& key, bool defaultValue)
+{
+	if (auto pref = prefs.get (key))
+		return *pref == "1";
+	return defaultValue;
+}
+
+//------------------------------------------------------------------------
+uint32_t getDefaultBuildJobs ()
+{
+	return std::max (1u, std::thread::hardware_concurrency ());
+}
+
+//------------------------------------------------------------------------
+/** returns 0 if the string is not a valid number of build jobs */
+uint32_t parseBuildJobs (const std::string& str)
+{
+	char* end = nullptr;
+	auto jobs = std::strtoul (str.data (), &end, 10);
+	if (str.empty () || *end != 0 || jobs < 1 || jobs > MaxBuildJobs)
+		return 0;
+	return static_cast<uint32_t> (jobs);
+}
+
+//------------------------------------------------------------------------
+/** cmake --build supports --parallel since 3.12 */
+bool supportsParallelBuild (const CMakeCapabilites& capabilities)
+{
+	return capabilities.versionMajor > 3 ||
+	       (capabilities.versionMajor == 3 && capabilities.versionMinor >= 12);
+}
+
+#if LINUX
+//------------------------------------------------------------------------
+bool isProgramInPath (const std::vector<std::string>& envPaths, const std::string& name)
+{
+	for (const auto& path : envPaths)
+	{
+		if (getFileModificationTime (path + name) != 0)
+			return true;
+	}
+	return false;
+}
+#endif // LINUX
+
+//------------------------------------------------------------------------
+/** the generator to select when there is no generator preference, empty to keep the first one
+ *
+ *	Ninja builds faster than make, so on Linux it is preferred when it is installed. cmake lists
+ *	the Ninja generators even if ninja is missing.
+ */
+std::string selectDefaultGenerator (const CMakeGeneratorIndex::StringList& generators,
+                                    const std::vector<std::string>& envPaths)
+{
+#if LINUX
+	if (!isProgramInPath (envPaths, "ninja"))
+		return {};
+	for (auto name : {"Ninja Multi-Config", "Ninja"})
+	{
+		if (std::find (generators.begin (), generators.end (), name) != generators.end ())
+			return name;
+	}
+#endif
+	return {};
+}
+
+//------------------------------------------------------------------------
+/** the generator and platform (empty for the default) of the build folder match the given ones
+ *
+ *	Generators with an extra generator are shown as "<extra> - <generator>" in the UI, cmake stores
+ *	them in two separate cache entries.
+ */
+bool isSameCMakeGenerator (const CMakeCacheEntries& cache, const std::string& generator,
+                           const std::string& platform)
+{
+	auto mainGenerator = generator;
+	std::string extraGenerator;
+	auto separator = generator.find (" - ");
+	if (separator != std::string::npos)
+	{
+		extraGenerator = generator.substr (0, separator);
+		mainGenerator = generator.substr (separator + 3);
+	}
+	return getCMakeCacheValue (cache, "CMAKE_GENERATOR") == mainGenerator &&
+	       getCMakeCacheValue (cache, "CMAKE_EXTRA_GENERATOR") == extraGenerator &&
+	       getCMakeCacheValue (cache, "CMAKE_GENERATOR_PLATFORM") == platform;
+}
+
 //------------------------------------------------------------------------
 UTF8String getValueString (IValue& value)
 {
@@ -212,6 +343,8 @@ void Controller::onSetContentView (IWindow& window, const VSTGUI::SharedPointer<
 //------------------------------------------------------------------------
 Controller::Controller ()
 {
+	StartupTraceScope traceScope ("Controller::Controller");
+
 	Preferences prefs;
 	auto vendorPref = prefs.get (valueIdVendorName);
 	auto emailPref = prefs.get (valueIdVendorEMail);
@@ -220,10 +353,21 @@ Controller::Controller ()
 	auto vstSdkPathPref = prefs.get (valueIdVSTSDKPath);
 	auto cmakePathPref = prefs.get (valueIdCMakePath);
 	auto pluginPathPref = prefs.get (valueIdPluginPath);
-
-	auto envPaths = getEnvPaths ();
+	auto incrementalReconfigurePref =
+	    getPreferenceBoolValue (prefs, valueIdIncrementalReconfigure, true);
+	auto usePrebuiltSDKPref = getPreferenceBoolValue (prefs, valueIdUsePrebuiltSDK, false);
+	auto useCompilerCachePref = getPreferenceBoolValue (prefs, valueIdUseCompilerCache, true);
+	auto reduceCompileTimePref = getPreferenceBoolValue (prefs, valueIdReduceCompileTime, true);
+	auto traceCompileTimePref = getPreferenceBoolValue (prefs, valueIdTraceCompileTime, false);
+	auto buildProjectPref = getPreferenceBoolValue (prefs, valueIdBuildProject, false);
+	auto buildJobsPref = prefs.get (valueIdBuildJobs);
+
+	// the PATH is only scanned if there is no stored cmake path
 	if (!cmakePathPref || cmakePathPref->empty ())
-		cmakePathPref = findCMakePath (envPaths);
+	{
+		StartupTraceScope findCMakeTraceScope ("Find CMake");
+		cmakePathPref = findCMakePath (getEnvPaths ());
+	}
 
 	model = UIDesc::ModelBindingCallbacks::make ();
 	/* UI only */
@@ -340,9 +484,9 @@ Controller::Controller ()
 		                 v.performEdit (0.);
 	                 }));
 
-	// Link List
+	// Link List (filled after the first frame, see onShow)
 	model->addValue (
-	    Value::makeStringListValue (valueIdLinkList, LinkController::instance ().getTitles ()),
+	    Value::makeStringListValue (valueIdLinkList, {"", ""}),
 	    UIDesc::ValueCalls::onEndEdit ([] (IValue& v) {
 		    auto index = v.getConverter ().normalizedToPlain (v.getValue ());
 		    const auto& urlList = LinkController::instance ().getUrls ();
@@ -365,6 +509,47 @@ Controller::Controller ()
 	model->addValue (Value::makeStringListValue (valueIdCMakeSupportedPlatforms, {"", ""}),
 	                 UIDesc::ValueCalls::onEndEdit ([this] (IValue&) { storePreferences (); }));
 
+	/* keep the build folder on regeneration */
+	model->addValue (Value::make (valueIdIncrementalReconfigure, incrementalReconfigurePref ? 1 : 0),
+	                 UIDesc::ValueCalls::onEndEdit ([this] (IValue&) { storePreferences (); }));
+
+	/* link against a shared build of the SDK */
+	model->addValue (Value::make (valueIdUsePrebuiltSDK, usePrebuiltSDKPref ? 1 : 0),
+	                 UIDesc::ValueCalls::onEndEdit ([this] (IValue&) { storePreferences (); }));
+
+	/* compiler cache */
+	model->addValue (Value::make (valueIdUseCompilerCache, useCompilerCachePref ? 1 : 0),
+	                 UIDesc::ValueCalls::onEndEdit ([this] (IValue&) { storePreferences (); }));
+
+	/* precompiled headers and unity builds */
+	model->addValue (Value::make (valueIdReduceCompileTime, reduceCompileTimePref ? 1 : 0),
+	                 UIDesc::ValueCalls::onEndEdit ([this] (IValue&) { storePreferences (); }));
+
+	/* compile time traces */
+	model->addValue (Value::make (valueIdTraceCompileTime, traceCompileTimePref ? 1 : 0),
+	                 UIDesc::ValueCalls::onEndEdit ([this] (IValue&) { storePreferences (); }));
+
+	model->addValue (Value::make (valueIdBenchmarkGenerators),
+	                 UIDesc::ValueCalls::onAction ([this] (IValue& v) {
+		                 benchmarkGenerators ();
+		                 v.performEdit (0.);
+	                 }));
+
+	/* build after configure */
+	model->addValue (Value::make (valueIdBuildProject, buildProjectPref ? 1 : 0),
+	                 UIDesc::ValueCalls::onEndEdit ([this] (IValue&) { storePreferences (); }));
+	model->addValue (
+	    Value::makeStringValue (valueIdBuildJobs,
+	                            buildJobsPref && parseBuildJobs (buildJobsPref->getString ())
+	                                ? *buildJobsPref
+	                                : UTF8String (std::to_string (getDefaultBuildJobs ()))),
+	    UIDesc::ValueCalls::onEndEdit ([this] (IValue& v) {
+		    if (!parseBuildJobs (getValueString (v).getString ()))
+			    Value::performStringValueEdit (v, std::to_string (getDefaultBuildJobs ()));
+		    else
+			    storePreferences ();
+	    }));
+
 	/* cmake version */
 	model->addValue (Value::makeStringValue (valueIdCMakeVersion, "CMake ?.?.?"));
 
@@ -420,6 +605,17 @@ void Controller::storePreferences ()
 
 	setPreferenceStringValue (prefs, valueIdMacOSDeploymentTarget,
 	                          model->getValue (valueIdMacOSDeploymentTarget));
+	setPreferenceBoolValue (prefs, valueIdIncrementalReconfigure,
+	                        model->getValue (valueIdIncrementalReconfigure));
+	setPreferenceBoolValue (prefs, valueIdUsePrebuiltSDK, model->getValue (valueIdUsePrebuiltSDK));
+	setPreferenceBoolValue (prefs, valueIdUseCompilerCache,
+	                        model->getValue (valueIdUseCompilerCache));
+	setPreferenceBoolValue (prefs, valueIdReduceCompileTime,
+	                        model->getValue (valueIdReduceCompileTime));
+	setPreferenceBoolValue (prefs, valueIdTraceCompileTime,
+	                        model->getValue (valueIdTraceCompileTime));
+	setPreferenceBoolValue (prefs, valueIdBuildProject, model->getValue (valueIdBuildProject));
+	setPreferenceStringValue (prefs, valueIdBuildJobs, model->getValue (valueIdBuildJobs));
 }
 
 //------------------------------------------------------------------------
@@ -428,19 +624,10 @@ void Controller::fillCmakeSupportedPlatforms (const std::string& currentGenerato
 	auto cmakeGeneratorsPlatformsValue = model->getValue (valueIdCMakeSupportedPlatforms);
 	assert (cmakeGeneratorsPlatformsValue);
 
-	for (auto& item : cmakeCapabilities.generators)
+	if (auto platforms = cmakeCapabilities.generatorIndex.findPlatforms (currentGenerator))
 	{
-		if (item.name == currentGenerator)
-		{
-			IStringListValue::StringList list;
-			list.emplace_back ("Defaults");
-			for (auto& platform : item.platforms)
-				list.emplace_back (platform);
-
-			cmakeGeneratorsPlatformsValue->dynamicCast<IStringListValue> ()->updateStringList (
-			    list);
-			break;
-		}
+		cmakeGeneratorsPlatformsValue->dynamicCast<IStringListValue> ()->updateStringList (
+		    *platforms);
 	}
 	// reset to default
 	cmakeGeneratorsPlatformsValue->performEdit (0);
@@ -470,6 +657,7 @@ void Controller::onScriptRunning (bool state)
 	    valueIdCMakeGenerators,
 	    valueIdCMakeSupportedPlatforms,
 	    valueIdMacOSDeploymentTarget,
+	    valueIdBenchmarkGenerators,
 	};
 	for (const auto& valueID : valuesToDisable)
 	{
@@ -481,13 +669,33 @@ void Controller::onScriptRunning (bool state)
 //------------------------------------------------------------------------
 void Controller::onShow (const IWindow& window)
 {
-	bool sdkInstallationVerified = verifySDKInstallation ();
-	bool cmakeInstallationVerified = verifyCMakeInstallation ();
-	Value::performSinglePlainEdit (*model->getValue (valueIdTabBar),
-	                               sdkInstallationVerified && cmakeInstallationVerified ? 1 : 0);
+	bool cmakeInstallationVerified = false;
+	{
+		StartupTraceScope traceScope ("Verify Installations");
+		bool sdkInstallationVerified = verifySDKInstallation ();
+		cmakeInstallationVerified = verifyCMakeInstallation ();
+		Value::performSinglePlainEdit (*model->getValue (valueIdTabBar),
+		                               sdkInstallationVerified && cmakeInstallationVerified ? 1 : 0);
+	}
+
+	// everything not needed to show the first tab is deferred until the window is on screen
+	Async::schedule (Async::mainQueue (), [this, cmakeInstallationVerified] () {
+		StartupTrace::instance ().finish ();
 
-	if (cmakeInstallationVerified)
-		gatherCMakeInformation ();
+		fillLinkList ();
+		if (cmakeInstallationVerified)
+			gatherCMakeInformation ();
+	});
+}
+
+//------------------------------------------------------------------------
+void Controller::fillLinkList ()
+{
+	if (auto value = model->getValue (valueIdLinkList))
+	{
+		if (auto listValue = value->dynamicCast<IStringListValue> ())
+			listValue->updateStringList (LinkController::instance ().getTitles ());
+	}
 }
 
 //------------------------------------------------------------------------
@@ -515,7 +723,7 @@ void Controller::gatherCMakeInformation ()
 		assert (scriptRunningValue);
 		Value::performSingleEdit (*scriptRunningValue, 1.);
 		auto outputString = std::make_shared<std::string> ();
-		auto result = process->run (args, [this, scriptRunningValue, outputString,
+		auto result = process->run (args, [this, scriptRunningValue, outputString, cmakePathStr,
 		                                   process] (Process::CallbackParams& p) mutable {
 			if (!p.buffer.empty ())
 			{
@@ -526,6 +734,7 @@ void Controller::gatherCMakeInformation ()
 				if (auto capabilities = parseCMakeCapabilities (*outputString))
 				{
 					cmakeCapabilities = std::move (*capabilities);
+					storeCMakeVersion (cmakePathStr.getString ());
 
 					auto cmakeVersionValue = model->getValue (valueIdCMakeVersion);
 					UTF8String str ("CMake ");
@@ -539,20 +748,15 @@ void Controller::gatherCMakeInformation ()
 
 					auto cmakeGeneratorsValue = model->getValue (valueIdCMakeGenerators);
 					assert (cmakeGeneratorsValue);
-					IStringListValue::StringList list;
-					for (auto& item : cmakeCapabilities.generators)
-					{
-#if WINDOWS
-						if (item.name.getString ().find ("Win64") == std::string::npos &&
-						    item.name.getString ().find ("ARM") == std::string::npos &&
-						    item.name.getString ().find ("IA64") == std::string::npos)
-#endif // WINDOWS
-							list.emplace_back (item.name);
-					}
-					cmakeGeneratorsValue->dynamicCast<IStringListValue> ()->updateStringList (list);
+					cmakeGeneratorsValue->dynamicCast<IStringListValue> ()->updateStringList (
+					    cmakeCapabilities.generatorIndex.getGeneratorNames ());
 
 					Preferences prefs;
-					if (auto generatorPref = prefs.get (valueIdCMakeGenerators))
+					const auto& generatorNames =
+					    cmakeCapabilities.generatorIndex.getGeneratorNames ();
+					auto generatorPref = prefs.get (valueIdCMakeGenerators);
+					if (generatorPref && std::find (generatorNames.begin (), generatorNames.end (),
+					                                *generatorPref) != generatorNames.end ())
 					{
 						auto value =
 						    cmakeGeneratorsValue->getConverter ().stringAsValue (*generatorPref);
@@ -572,7 +776,13 @@ void Controller::gatherCMakeInformation ()
 					}
 					else
 					{
-						// we should use some defaults here
+						auto generator = selectDefaultGenerator (generatorNames, getEnvPaths ());
+						if (!generator.empty ())
+						{
+							cmakeGeneratorsValue->performEdit (
+							    cmakeGeneratorsValue->getConverter ().stringAsValue (generator));
+							fillCmakeSupportedPlatforms (generator);
+						}
 					}
 				}
 				else
@@ -623,9 +833,8 @@ void Controller::chooseVSTSDKPath ()
 	    valueIdVSTSDKPath, CNewFileSelector::kSelectDirectory, [this] (const UTF8String& path) {
 		    if (!validateVSTSDKPath (path))
 		    {
-			    showSimpleAlert (
-			        "Wrong VST SDK path!",
-			        "The selected folder does not look like the root folder of the VST SDK.");
+			    showSimpleAlert ("Wrong VST SDK path!",
+			                     makeInvalidVSTSDKDescription (vstSDKIndex).data ());
 			    return false;
 		    }
 		    Async::schedule (Async::mainQueue (), [this] () { verifySDKInstallation (); });
@@ -709,6 +918,9 @@ bool Controller::verifySDKInstallation ()
 	auto sdkPathStr = getModelValueString (model, valueIdVSTSDKPath);
 	auto result = !(sdkPathStr.empty () || !validateVSTSDKPath (sdkPathStr));
 	Value::performSinglePlainEdit (*model->getValue (valueIdValidVSTSDKPath), result);
+	// an SDK without its vstgui submodule cannot build an editor
+	if (result && !vstSDKIndex.hasVSTGUI)
+		Value::performSinglePlainEdit (*model->getValue (valueIdUseVSTGUI), 0);
 	return result;
 }
 
@@ -740,16 +952,18 @@ void Controller::showCMakeNotInstalledWarning ()
 //------------------------------------------------------------------------
 bool Controller::validateVSTSDKPath (const UTF8String& path)
 {
-	auto p = path.getString ();
-	if (*p.rbegin () != PlatformPathDelimiter)
-		p += PlatformPathDelimiter;
-	p += "pluginterfaces";
-	p += PlatformPathDelimiter;
-	p += "vst";
-	p += PlatformPathDelimiter;
-	p += "vsttypes.h";
-	std::ifstream stream (p);
-	return stream.is_open ();
+	return updateVSTSDKIndex (path).isValid ();
+}
+
+//------------------------------------------------------------------------
+const VSTSDKIndex& Controller::updateVSTSDKIndex (const UTF8String& path)
+{
+	std::string cacheFilePath;
+	if (auto cachePath = IApplication::instance ().getCommonDirectories ().get (
+	        CommonDirectoryLocation::AppCachesPath, "", true))
+		cacheFilePath = cachePath->getString () + VSTSDKIndexCacheFileName;
+	vstSDKIndex = getVSTSDKIndex (path.getString (), cacheFilePath);
+	return vstSDKIndex;
 }
 
 //------------------------------------------------------------------------
@@ -795,11 +1009,25 @@ void Controller::createProject ()
 
 	auto pluginUseVSTGUI = model->getValue (valueIdUseVSTGUI)->getValue () != 0;
 
-	if (_sdkPathStr.empty () || !validateVSTSDKPath (_sdkPathStr))
+	if (_sdkPathStr.empty ())
 	{
 		showSimpleAlert ("Cannot create Project", "The VST3 SDK path is not correct.");
 		return;
 	}
+	// the SDK may have changed since it was selected, the index is rebuilt if so
+	if (!validateVSTSDKPath (_sdkPathStr))
+	{
+		showSimpleAlert ("Cannot create Project",
+		                 makeInvalidVSTSDKDescription (vstSDKIndex).data ());
+		return;
+	}
+	if (pluginUseVSTGUI && !vstSDKIndex.hasVSTGUI)
+	{
+		showSimpleAlert ("Cannot create Project",
+		                 "The VST3 SDK does not contain VSTGUI, disable 'Use VSTGUI' or check out "
+		                 "the vstgui4 submodule of the SDK.");
+		return;
+	}
 	auto sdkPathStr = _sdkPathStr.getString ();
 	unixfyPath (sdkPathStr);
 	if (_pluginOutputPathStr.empty ())
@@ -836,6 +1064,8 @@ void Controller::createProject ()
 
 		Process::ArgumentList args;
 		args.add ("-DSMTG_VST3_SDK_SOURCE_DIR_CLI=\"" + sdkPathStr + "\"");
+		if (!vstSDKIndex.version.empty ())
+			args.add ("-DSMTG_VST3_SDK_VERSION_CLI=" + vstSDKIndex.version);
 		args.add ("-DSMTG_GENERATOR_OUTPUT_DIRECTORY_CLI=\"" + pluginOutputPathStr + "\"");
 		args.add ("-DSMTG_PLUGIN_NAME_CLI=\"" + pluginNameStr + "\"");
 		args.add ("-DSMTG_PLUGIN_CATEGORY_CLI=\"" + pluginTypeStr + "\"");
@@ -857,8 +1087,32 @@ void Controller::createProject ()
 		else
 			args.add ("-DSMTG_ENABLE_VSTGUI_SUPPORT_CLI=OFF");
 
+		if (model->getValue (valueIdUsePrebuiltSDK)->getValue () != 0)
+			args.add ("-DSMTG_USE_PREBUILT_SDK_CLI=ON");
+		else
+			args.add ("-DSMTG_USE_PREBUILT_SDK_CLI=OFF");
+		if (model->getValue (valueIdUseCompilerCache)->getValue () != 0)
+			args.add ("-DSMTG_COMPILER_CACHE_CLI=AUTO");
+		else
+			args.add ("-DSMTG_COMPILER_CACHE_CLI=OFF");
+		if (model->getValue (valueIdReduceCompileTime)->getValue () != 0)
+		{
+			args.add ("-DSMTG_PRECOMPILED_HEADERS_CLI=ON");
+			args.add ("-DSMTG_UNITY_BUILD_CLI=ON");
+		}
+		else
+		{
+			args.add ("-DSMTG_PRECOMPILED_HEADERS_CLI=OFF");
+			args.add ("-DSMTG_UNITY_BUILD_CLI=OFF");
+		}
+		if (model->getValue (valueIdTraceCompileTime)->getValue () != 0)
+			args.add ("-DSMTG_TIME_TRACE_CLI=ON");
+		else
+			args.add ("-DSMTG_TIME_TRACE_CLI=OFF");
+
 		args.add ("-P");
 		args.addPath (scriptPath->getString ());
+		args.mergeErrorOutput = true;
 
 		if (auto process = Process::create (cmakePathStr))
 		{
@@ -905,88 +1159,444 @@ void Controller::createProject ()
 void Controller::runProjectCMake (const std::string& path)
 {
 	auto cmakePathStr = getModelValueString (model, valueIdCMakePath);
-	auto value = model->getValue (valueIdCMakeGenerators);
-	assert (value);
-	if (!value)
-		return;
-	auto generator = value->getConverter ().valueAsString (value->getValue ());
+	auto scriptRunningValue = model->getValue (valueIdScriptRunning);
+	assert (scriptRunningValue);
+	auto scriptOutputValue = model->getValue (valueIdScriptOutput);
+
+	auto buildDir = path;
+	buildDir += PlatformPathDelimiter;
+	buildDir += "build";
+
+	// a build folder configured with the same generator and platform only needs a reconfigure,
+	// which keeps the already configured VST3 SDK and VSTGUI targets
+	if (model->getValue (valueIdIncrementalReconfigure)->getValue () != 0)
+	{
+		auto generators = model->getValue (valueIdCMakeGenerators);
+		auto platforms = model->getValue (valueIdCMakeSupportedPlatforms);
+		assert (generators && platforms);
+		auto generator =
+		    generators->getConverter ().valueAsString (generators->getValue ()).getString ();
+		auto platform =
+		    platforms->getConverter ().valueAsString (platforms->getValue ()).getString ();
+		if (platform == "Defaults")
+			platform.clear ();
+		auto cache = readCMakeCache (buildDir);
+		if (cache && isSameCMakeGenerator (*cache, generator, platform))
+		{
+			Value::performStringAppendValueEdit (*scriptOutputValue,
+			                                     "\nReusing the existing build folder " + buildDir);
+			Value::performSingleEdit (*scriptRunningValue, 1.);
+			configureProject (path, buildDir);
+			return;
+		}
+	}
+
+	// delete the previous build folder and configure when it is gone
 	if (auto process = Process::create (cmakePathStr.getString ()))
 	{
-		auto scriptRunningValue = model->getValue (valueIdScriptRunning);
-		assert (scriptRunningValue);
 		Value::performSingleEdit (*scriptRunningValue, 1.);
-		auto scriptOutputValue = model->getValue (valueIdScriptOutput);
 
-		auto buildDir = path;
-		buildDir += PlatformPathDelimiter;
-		buildDir += "build";
-
-		// first: delete previous build folder
 		Process::ArgumentList prepareArgs;
 		prepareArgs.add ("-E");
 		prepareArgs.add ("remove_directory");
 		prepareArgs.addPath (buildDir);
-		process->run (prepareArgs,
-		              [process] (Process::CallbackParams& p) mutable { process.reset (); });
+		auto result = process->run (
+		    prepareArgs, [this, process, path, buildDir] (Process::CallbackParams& p) mutable {
+			    if (p.isEOF)
+			    {
+				    configureProject (path, buildDir);
+				    process.reset ();
+			    }
+		    });
+		if (!result)
+			Value::performSingleEdit (*scriptRunningValue, 0.);
+	}
+}
 
-		// now build the cmake command
-		Process::ArgumentList args;
+//------------------------------------------------------------------------
+void Controller::configureProject (const std::string& path, const std::string& buildDir)
+{
+	auto cmakePathStr = getModelValueString (model, valueIdCMakePath);
+	auto value = model->getValue (valueIdCMakeGenerators);
+	assert (value);
+	if (!value)
+		return;
+	auto generator = value->getConverter ().valueAsString (value->getValue ());
+	auto scriptRunningValue = model->getValue (valueIdScriptRunning);
+	assert (scriptRunningValue);
+	auto scriptOutputValue = model->getValue (valueIdScriptOutput);
 
-		// Generator Name
-		args.add ("-G");
-		args.addPath (generator.getString ());
+	// now build the cmake command
+	Process::ArgumentList args;
 
-		// Platform Name
-		if (auto platforms = model->getValue (valueIdCMakeSupportedPlatforms))
-		{
-			auto platform = platforms->getConverter ().valueAsString (platforms->getValue ());
-			if (!platform.empty () && platform != "Defaults")
-				args.add ("-A " + platform.getString ());
-		}
+	// Generator Name
+	args.add ("-G");
+	args.addPath (generator.getString ());
 
-		// Path to Source
-		args.add ("-S");
-		args.addPath (path);
+	// Platform Name
+	if (auto platforms = model->getValue (valueIdCMakeSupportedPlatforms))
+	{
+		auto platform = platforms->getConverter ().valueAsString (platforms->getValue ());
+		if (!platform.empty () && platform != "Defaults")
+			args.add ("-A " + platform.getString ());
+	}
 
-		// Path to Build
-		args.add ("-B");
-		args.addPath (buildDir);
+	// Path to Source
+	args.add ("-S");
+	args.addPath (path);
 
-		if (auto pluginUseVSTGUI = model->getValue (valueIdUseVSTGUI)->getValue () != 0)
-			args.add ("-DSMTG_ADD_VSTGUI=ON");
-		else
-			args.add ("-DSMTG_ADD_VSTGUI=OFF");
+	// Path to Build
+	args.add ("-B");
+	args.addPath (buildDir);
 
-		Value::performStringAppendValueEdit (*scriptOutputValue, "\n" + cmakePathStr + " ");
-		for (const auto& a : args.args)
-			Value::performStringAppendValueEdit (*scriptOutputValue, UTF8String (a) + " ");
-		Value::performStringAppendValueEdit (*scriptOutputValue, "\n");
+	addProjectOptions (args, true);
+	args.mergeErrorOutput = true;
 
-		bool result = false;
-		if ((process = Process::create (cmakePathStr.getString ())))
-		{
-			result = process->run (args, [this, scriptRunningValue, scriptOutputValue, buildDir,
-			                              process] (Process::CallbackParams& p) mutable {
-				if (!p.buffer.empty ())
+	Value::performStringAppendValueEdit (*scriptOutputValue, "\n" + cmakePathStr + " ");
+	for (const auto& a : args.args)
+		Value::performStringAppendValueEdit (*scriptOutputValue, UTF8String (a) + " ");
+	Value::performStringAppendValueEdit (*scriptOutputValue, "\n");
+
+	bool result = false;
+	if (auto process = Process::create (cmakePathStr.getString ()))
+	{
+		result = process->run (args, [this, scriptRunningValue, scriptOutputValue, buildDir,
+		                              process] (Process::CallbackParams& p) mutable {
+			if (!p.buffer.empty ())
+			{
+				Value::performStringAppendValueEdit (
+				    *scriptOutputValue, std::string (p.buffer.data (), p.buffer.size ()));
+			}
+			if (p.isEOF)
+			{
+				assert (scriptRunningValue);
+				Value::performSingleEdit (*scriptRunningValue, 0.);
+				if (p.resultCode == 0)
 				{
-					Value::performStringAppendValueEdit (
-					    *scriptOutputValue, std::string (p.buffer.data (), p.buffer.size ()));
+					if (model->getValue (valueIdBuildProject)->getValue () != 0)
+						buildProject (buildDir);
+					else
+						openCMakeGeneratedProject (buildDir);
 				}
-				if (p.isEOF)
+				process.reset ();
+			}
+		});
+	}
+	if (!result)
+	{
+		// TODO: Show error
+		Value::performSingleEdit (*scriptRunningValue, 0.);
+	}
+}
+
+//------------------------------------------------------------------------
+void Controller::addProjectOptions (Process::ArgumentList& args, bool allowSharedBuildResults)
+{
+	if (auto pluginUseVSTGUI = model->getValue (valueIdUseVSTGUI)->getValue () != 0)
+		args.add ("-DSMTG_ADD_VSTGUI=ON");
+	else
+		args.add ("-DSMTG_ADD_VSTGUI=OFF");
+
+	// the options are cached, an incremental reconfigure would keep the previous values
+	if (allowSharedBuildResults && model->getValue (valueIdUsePrebuiltSDK)->getValue () != 0)
+		args.add ("-DSMTG_PLUGIN_USE_PREBUILT_SDK=ON");
+	else
+		args.add ("-DSMTG_PLUGIN_USE_PREBUILT_SDK=OFF");
+	if (allowSharedBuildResults && model->getValue (valueIdUseCompilerCache)->getValue () != 0)
+		args.add ("-DSMTG_PLUGIN_COMPILER_CACHE=AUTO");
+	else
+		args.add ("-DSMTG_PLUGIN_COMPILER_CACHE=OFF");
+	if (model->getValue (valueIdReduceCompileTime)->getValue () != 0)
+	{
+		args.add ("-DSMTG_PLUGIN_PRECOMPILED_HEADERS=ON");
+		args.add ("-DSMTG_PLUGIN_UNITY_BUILD=ON");
+	}
+	else
+	{
+		args.add ("-DSMTG_PLUGIN_PRECOMPILED_HEADERS=OFF");
+		args.add ("-DSMTG_PLUGIN_UNITY_BUILD=OFF");
+	}
+	if (model->getValue (valueIdTraceCompileTime)->getValue () != 0)
+		args.add ("-DSMTG_PLUGIN_TIME_TRACE=ON");
+	else
+		args.add ("-DSMTG_PLUGIN_TIME_TRACE=OFF");
+}
+
+//------------------------------------------------------------------------
+uint32_t Controller::getBuildJobs () const
+{
+	if (auto jobs = parseBuildJobs (getModelValueString (model, valueIdBuildJobs).getString ()))
+		return jobs;
+	return getDefaultBuildJobs ();
+}
+
+//------------------------------------------------------------------------
+void Controller::buildProject (const std::string& buildDir)
+{
+	auto scriptRunningValue = model->getValue (valueIdScriptRunning);
+	assert (scriptRunningValue);
+	Value::performSingleEdit (*scriptRunningValue, 1.);
+
+	// the compiler cache found when the project was configured
+	std::string compilerCache;
+	if (auto cache = readCMakeCache (buildDir))
+		compilerCache = getCMakeCacheValue (*cache, "SMTG_PLUGIN_COMPILER_CACHE_PROGRAM");
+	if (compilerCache.empty () ||
+	    getCompilerCacheType (compilerCache) == CompilerCacheType::Unknown)
+	{
+		runBuild (buildDir, {}, {});
+		return;
+	}
+	readCompilerCacheStats (compilerCache,
+	                        [this, buildDir, compilerCache] (const CompilerCacheStats& stats) {
+		                        runBuild (buildDir, compilerCache, stats);
+	                        });
+}
+
+//------------------------------------------------------------------------
+void Controller::runBuild (const std::string& buildDir, const std::string& compilerCache,
+                           const CompilerCacheStats& statsBefore)
+{
+	auto cmakePathStr = getModelValueString (model, valueIdCMakePath);
+	auto scriptOutputValue = model->getValue (valueIdScriptOutput);
+
+	Process::ArgumentList args;
+	args.add ("--build");
+	args.addPath (buildDir);
+	// multi config generators build the first configuration without --config, which is Debug
+	// for all of them, so it is not needed
+	if (supportsParallelBuild (cmakeCapabilities))
+	{
+		args.add ("--parallel");
+		args.add (std::to_string (getBuildJobs ()));
+	}
+	args.mergeErrorOutput = true;
+
+	Value::performStringAppendValueEdit (*scriptOutputValue, "\n" + cmakePathStr + " ");
+	for (const auto& a : args.args)
+		Value::performStringAppendValueEdit (*scriptOutputValue, UTF8String (a) + " ");
+	Value::performStringAppendValueEdit (*scriptOutputValue, "\n");
+
+	bool result = false;
+	if (auto process = Process::create (cmakePathStr.getString ()))
+	{
+		buildTimings.start (buildDir);
+		// the traces of sources which are not compiled again are left from earlier builds
+		auto buildStartTime = static_cast<int64_t> (std::time (nullptr));
+		result = process->run (args, [this, scriptOutputValue, buildDir, compilerCache,
+		                              statsBefore, buildStartTime,
+		                              process] (Process::CallbackParams& p) mutable {
+			if (!p.buffer.empty ())
+			{
+				buildTimings.onOutput (p.buffer.data (), p.buffer.size ());
+				Value::performStringAppendValueEdit (
+				    *scriptOutputValue, std::string (p.buffer.data (), p.buffer.size ()));
+			}
+			if (p.isEOF)
+			{
+				Value::performStringAppendValueEdit (*scriptOutputValue, buildTimings.finish ());
+				auto succeeded = p.resultCode == 0;
+				if (!succeeded)
+					Value::performStringAppendValueEdit (*scriptOutputValue,
+					                                     "The build failed.\n");
+				if (!compilerCache.empty () && statsBefore.valid)
 				{
-					assert (scriptRunningValue);
-					Value::performSingleEdit (*scriptRunningValue, 0.);
-					if (p.resultCode == 0)
-						openCMakeGeneratedProject (buildDir);
-					process.reset ();
+					readCompilerCacheStats (compilerCache, [this, scriptOutputValue, buildDir,
+					                                        statsBefore, succeeded, buildStartTime] (
+					                                           const CompilerCacheStats& stats) {
+						Value::performStringAppendValueEdit (
+						    *scriptOutputValue, makeCompilerCacheReport (statsBefore, stats));
+						summarizeTimeTraces (buildDir, succeeded, buildStartTime);
+					});
 				}
-			});
-		}
-		if (!result)
-		{
-			// TODO: Show error
-			Value::performSingleEdit (*scriptRunningValue, 0.);
-		}
+				else
+					summarizeTimeTraces (buildDir, succeeded, buildStartTime);
+				process.reset ();
+			}
+		});
+	}
+	if (!result)
+	{
+		// TODO: Show error
+		finishBuild (buildDir, false);
+	}
+}
+
+//------------------------------------------------------------------------
+void Controller::summarizeTimeTraces (const std::string& buildDir, bool succeeded,
+                                      int64_t buildStartTime)
+{
+	auto cache = readCMakeCache (buildDir);
+	if (!cache || !isCMakeTrue (getCMakeCacheValue (*cache, "SMTG_PLUGIN_TIME_TRACE")))
+	{
+		finishBuild (buildDir, succeeded);
+		return;
+	}
+	// a build of the SDK writes some hundred traces, they are parsed in the background
+	Async::schedule (Async::backgroundQueue (), [this, buildDir, succeeded, buildStartTime] () {
+		TimeTraceSummary summary;
+		summary.addBuildDirectory (buildDir, buildStartTime);
+		auto report = summary.getNumTraces () ?
+		                  summary.makeReport (MaxTimeTraceReportEntries) :
+		                  std::string ("\nNo compile time traces of this build found.\n");
+		Async::schedule (Async::mainQueue (), [this, buildDir, succeeded, report] () {
+			Value::performStringAppendValueEdit (*model->getValue (valueIdScriptOutput), report);
+			finishBuild (buildDir, succeeded);
+		});
+	});
+}
+
+//------------------------------------------------------------------------
+void Controller::finishBuild (const std::string& buildDir, bool succeeded)
+{
+	auto scriptRunningValue = model->getValue (valueIdScriptRunning);
+	assert (scriptRunningValue);
+	Value::performSingleEdit (*scriptRunningValue, 0.);
+	if (succeeded)
+		openCMakeGeneratedProject (buildDir);
+}
+
+//------------------------------------------------------------------------
+void Controller::readCompilerCacheStats (const std::string& compilerCache,
+                                         CompilerCacheStatsCallback&& callback)
+{
+	auto type = getCompilerCacheType (compilerCache);
+	auto output = std::make_shared<std::string> ();
+	bool result = false;
+	if (auto process = Process::create (compilerCache))
+	{
+		result = process->run (
+		    makeCompilerCacheStatsArguments (type),
+		    [type, output, callback, process] (Process::CallbackParams& p) mutable {
+			    output->append (p.buffer.data (), p.buffer.size ());
+			    if (p.isEOF)
+			    {
+				    callback (p.resultCode == 0 ? parseCompilerCacheStats (type, *output)
+				                                : CompilerCacheStats {});
+				    process.reset ();
+			    }
+		    });
+	}
+	if (!result)
+		callback ({});
+}
+
+//------------------------------------------------------------------------
+void Controller::benchmarkGenerators ()
+{
+	if (cmakeCapabilities.versionMajor == 0)
+	{
+		showCMakeNotInstalledWarning ();
+		return;
+	}
+	auto sdkPath = getModelValueString (model, valueIdVSTSDKPath);
+	if (sdkPath.empty () || !validateVSTSDKPath (sdkPath))
+	{
+		showSimpleAlert ("Cannot benchmark the generators",
+		                 makeInvalidVSTSDKDescription (vstSDKIndex).data ());
+		return;
+	}
+	auto pluginUseVSTGUI = model->getValue (valueIdUseVSTGUI)->getValue () != 0;
+	if (pluginUseVSTGUI && !vstSDKIndex.hasVSTGUI)
+	{
+		showSimpleAlert ("Cannot benchmark the generators",
+		                 "The VST3 SDK does not contain VSTGUI, disable 'Use VSTGUI' or check out "
+		                 "the vstgui4 submodule of the SDK.");
+		return;
+	}
+
+	std::vector<std::string> generatorNames;
+	for (const auto& name : cmakeCapabilities.generatorIndex.getGeneratorNames ())
+		generatorNames.emplace_back (name.getString ());
+	auto generators = GeneratorBenchmark::selectGenerators (generatorNames);
+	if (generators.empty ())
+	{
+		showSimpleAlert ("Cannot benchmark the generators", "No generator found.");
+		return;
+	}
+
+	auto& directories = IApplication::instance ().getCommonDirectories ();
+	auto scriptPath = directories.get (CommonDirectoryLocation::AppResourcesPath);
+	auto cachePath = directories.get (CommonDirectoryLocation::AppCachesPath, "", true);
+	if (!scriptPath || !cachePath)
+		return;
+	*scriptPath += "GenerateVST3Plugin.cmake";
+
+	auto sdkPathStr = sdkPath.getString ();
+	unixfyPath (sdkPathStr);
+
+	GeneratorBenchmark::Settings settings;
+	settings.cmakePath = getModelValueString (model, valueIdCMakePath).getString ();
+	settings.workDir = cachePath->getString () + GeneratorBenchmarkFolderName;
+	settings.projectDir = settings.workDir + PlatformPathDelimiter + GeneratorBenchmarkFolderName;
+	auto workDir = settings.workDir;
+	unixfyPath (workDir);
+
+	// the generated sample project is a plain effect
+	auto& generateArgs = settings.generateArguments;
+	generateArgs.add ("-DSMTG_VST3_SDK_SOURCE_DIR_CLI=\"" + sdkPathStr + "\"");
+	if (!vstSDKIndex.version.empty ())
+		generateArgs.add ("-DSMTG_VST3_SDK_VERSION_CLI=" + vstSDKIndex.version);
+	generateArgs.add ("-DSMTG_GENERATOR_OUTPUT_DIRECTORY_CLI=\"" + workDir + "\"");
+	generateArgs.add (std::string ("-DSMTG_PLUGIN_NAME_CLI=") + GeneratorBenchmarkFolderName);
+	generateArgs.add (std::string ("-DSMTG_CMAKE_PROJECT_NAME_CLI=") + GeneratorBenchmarkFolderName);
+	generateArgs.add ("-DSMTG_PLUGIN_IDENTIFIER_CLI=com.steinberg.vst3.generatorbenchmark");
+	generateArgs.add (pluginUseVSTGUI ? "-DSMTG_ENABLE_VSTGUI_SUPPORT_CLI=ON"
+	                                  : "-DSMTG_ENABLE_VSTGUI_SUPPORT_CLI=OFF");
+	generateArgs.add ("-P");
+	generateArgs.addPath (scriptPath->getString ());
+
+	// shared build results would make the generators measured later faster
+	addProjectOptions (settings.configureArguments, false);
+	// tracing slows down the compiler
+	settings.configureArguments.add ("-DSMTG_PLUGIN_TIME_TRACE=OFF");
+	settings.generators = std::move (generators);
+	if (supportsParallelBuild (cmakeCapabilities))
+		settings.buildJobs = getBuildJobs ();
+
+	auto scriptRunningValue = model->getValue (valueIdScriptRunning);
+	auto scriptOutputValue = model->getValue (valueIdScriptOutput);
+	assert (scriptRunningValue && scriptOutputValue);
+	Value::performStringValueEdit (*scriptOutputValue, "Benchmarking the cmake generators\n");
+	Value::performSingleEdit (*scriptRunningValue, 1.);
+
+	auto resultsPath = cachePath->getString () + GeneratorBenchmarkResultsFileName;
+	auto benchmark = GeneratorBenchmark::create (std::move (settings));
+	auto started = benchmark->start (
+	    [scriptOutputValue] (const std::string& output) {
+		    Value::performStringAppendValueEdit (*scriptOutputValue, output);
+	    },
+	    [this, scriptRunningValue, scriptOutputValue,
+	     resultsPath] (const GeneratorBenchmark::Results& results) {
+		    if (results.empty ())
+		    {
+			    Value::performStringAppendValueEdit (
+			        *scriptOutputValue, "\nThe sample project could not be generated.\n");
+		    }
+		    else
+		    {
+			    Value::performStringAppendValueEdit (*scriptOutputValue,
+			                                         GeneratorBenchmark::makeReport (results));
+			    if (GeneratorBenchmark::appendToCSVFile (resultsPath, results))
+				    Value::performStringAppendValueEdit (
+				        *scriptOutputValue, "The results were added to " + resultsPath + "\n");
+		    }
+		    Value::performSingleEdit (*scriptRunningValue, 0.);
+		    if (auto fastest = GeneratorBenchmark::findFastest (results))
+		    {
+			    Value::performStringAppendValueEdit (
+			        *scriptOutputValue, "Selected the fastest generator " + fastest->generator + "\n");
+			    // a single edit runs onEndEdit: stores the preferences and fills the platforms
+			    auto generatorsValue = model->getValue (valueIdCMakeGenerators);
+			    Value::performSingleEdit (
+			        *generatorsValue,
+			        generatorsValue->getConverter ().stringAsValue (fastest->generator));
+		    }
+	    });
+	if (!started)
+	{
+		showSimpleAlert ("Could not execute CMake", "Please verify your path to CMake!");
+		Value::performSingleEdit (*scriptRunningValue, 0.);
 	}
 }
 
@@ -1069,37 +1679,43 @@ auto Controller::getEnvPaths () -> StringList
 //------------------------------------------------------------------------
 VSTGUI::Optional<UTF8String> Controller::findCMakePath (const StringList& envPaths)
 {
-	if (!envPaths.empty ())
-	{
-		for (auto path : envPaths)
-		{
-			path += CMakeExecutableName;
-			std::ifstream stream (path);
-			if (stream.is_open ())
-			{
-				return {std::move (path)};
-			}
-		}
-	}
-#if !WINDOWS
-	{
-		std::string path = "/usr/local/bin/cmake";
-		std::ifstream stream (path);
-		if (stream.is_open ())
-			return {std::move (path)};
-	}
+	auto searchPaths = envPaths;
+	// common installation directories which are not always part of the PATH
+#if WINDOWS
+	searchPaths.emplace_back ("C:\\Program Files\\CMake\\bin\\");
+#else
+	searchPaths.emplace_back ("/usr/local/bin/");
 #endif
 #if MAC
-	{
-		std::string path = "/Applications/CMake.app/Contents/bin/cmake";
-		std::ifstream stream (path);
-		if (stream.is_open ())
-			return {std::move (path)};
-	}
+	searchPaths.emplace_back ("/opt/homebrew/bin/");
+	searchPaths.emplace_back ("/Applications/CMake.app/Contents/bin/");
 #endif
+
+	CMakeVersionCache versionCache;
+	Preferences prefs;
+	if (auto cachePref = prefs.get (preferenceIdCMakeVersionCache))
+		versionCache.restore (cachePref->getString ());
+
+	auto installations = findCMakeInstallations (searchPaths, CMakeExecutableName, versionCache);
+	if (auto installation = selectCMakeInstallation (installations))
+		return {UTF8String (installation->path)};
 	return {};
 }
 
+//------------------------------------------------------------------------
+void Controller::storeCMakeVersion (const std::string& cmakePath)
+{
+	CMakeVersionCache versionCache;
+	Preferences prefs;
+	if (auto cachePref = prefs.get (preferenceIdCMakeVersionCache))
+		versionCache.restore (cachePref->getString ());
+
+	versionCache.store (cmakePath, getFileModificationTime (cmakePath),
+	                    {cmakeCapabilities.versionMajor, cmakeCapabilities.versionMinor,
+	                     cmakeCapabilities.versionPatch});
+	prefs.set (preferenceIdCMakeVersionCache, UTF8String (versionCache.serialize ()));
+}
+
 //------------------------------------------------------------------------
 const IMenuBuilder* Controller::getWindowMenuBuilder (const IWindow& window) const
 {
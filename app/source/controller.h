@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include "buildtimings.h"
 #include "cmakecapabilities.h"
+#include "compilercache.h"
+#include "vstsdkindex.h"
 #include "vstgui/lib/cfileselector.h"
 #include "vstgui/lib/cframe.h"
 #include "vstgui/standalone/include/helpers/menubuilder.h"
@@ -43,6 +46,14 @@ static constexpr auto valueIdCreateIDEProject = "Create IDE Project";
 static constexpr auto valueIdCMakeVersion = "CMake Version";
 static constexpr auto valueIdCMakeGenerators = "CMake Generators";
 static constexpr auto valueIdCMakeSupportedPlatforms = "CMake SupportedPlatforms";
+static constexpr auto valueIdIncrementalReconfigure = "Incremental Reconfigure";
+static constexpr auto valueIdUsePrebuiltSDK = "Use Prebuilt SDK";
+static constexpr auto valueIdUseCompilerCache = "Use Compiler Cache";
+static constexpr auto valueIdReduceCompileTime = "Reduce Compile Time";
+static constexpr auto valueIdTraceCompileTime = "Trace Compile Time";
+static constexpr auto valueIdBenchmarkGenerators = "Benchmark Generators";
+static constexpr auto valueIdBuildProject = "Build Project";
+static constexpr auto valueIdBuildJobs = "Build Jobs";
 
 static constexpr auto valueIdScriptOutput = "Script Output";
 static constexpr auto valueIdScriptRunning = "Script Running";
@@ -76,6 +87,7 @@ private:
 	const IMenuBuilder* getWindowMenuBuilder (const IWindow& window) const override;
 
 	void storePreferences ();
+	void fillLinkList ();
 
 	void chooseVSTSDKPath ();
 	void chooseCMakePath ();
@@ -93,6 +105,21 @@ private:
 
 	void createProject ();
 	void runProjectCMake (const std::string& path);
+	void configureProject (const std::string& path, const std::string& buildDir);
+	/** adds the cmake options of the generated project taken from the preferences, without
+	 *	shared build results the prebuilt SDK and the compiler cache are turned off */
+	void addProjectOptions (Process::ArgumentList& args, bool allowSharedBuildResults);
+	void buildProject (const std::string& buildDir);
+	void runBuild (const std::string& buildDir, const std::string& compilerCache,
+	               const CompilerCacheStats& statsBefore);
+	/** appends the summary of the compile time traces if the project was configured with them */
+	void summarizeTimeTraces (const std::string& buildDir, bool succeeded, int64_t buildStartTime);
+	void finishBuild (const std::string& buildDir, bool succeeded);
+	using CompilerCacheStatsCallback = std::function<void (const CompilerCacheStats&)>;
+	void readCompilerCacheStats (const std::string& compilerCache,
+	                             CompilerCacheStatsCallback&& callback);
+	uint32_t getBuildJobs () const;
+	void benchmarkGenerators ();
 	void openCMakeGeneratedProject (const std::string& path);
 
 	template <typename Proc>
@@ -100,6 +127,7 @@ private:
 	                      Proc proc) const;
 
 	bool validateVSTSDKPath (const UTF8String& path);
+	const VSTSDKIndex& updateVSTSDKIndex (const UTF8String& path);
 	bool validateCMakePath (const UTF8String& path);
 	bool validatePluginPath (const UTF8String& path);
 
@@ -109,11 +137,14 @@ private:
 
 	StringList getEnvPaths ();
 	VSTGUI::Optional<UTF8String> findCMakePath (const StringList& envPaths);
+	void storeCMakeVersion (const std::string& cmakePath);
 
 	VSTGUI::Standalone::UIDesc::ModelBindingCallbacksPtr model;
 	VSTGUI::SharedPointer<CFrame> contentView;
 
 	CMakeCapabilites cmakeCapabilities = {};
+	VSTSDKIndex vstSDKIndex;
+	BuildTimings buildTimings;
 };
 
 //------------------------------------------------------------------------
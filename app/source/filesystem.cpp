@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#include "filesystem.h"
+
+#include <sys/stat.h>
+
+#if WINDOWS
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+#if WINDOWS
+//------------------------------------------------------------------------
+std::wstring toWideString (const std::string& str)
+{
+	auto numChars = MultiByteToWideChar (CP_UTF8, 0, str.data (), static_cast<int> (str.size ()),
+	                                     nullptr, 0);
+	std::wstring result (static_cast<size_t> (numChars), 0);
+	MultiByteToWideChar (CP_UTF8, 0, str.data (), static_cast<int> (str.size ()), &result[0],
+	                     numChars);
+	return result;
+}
+
+//------------------------------------------------------------------------
+std::string toUTF8String (const wchar_t* str)
+{
+	auto numBytes = WideCharToMultiByte (CP_UTF8, 0, str, -1, nullptr, 0, nullptr, nullptr);
+	if (numBytes <= 1)
+		return {};
+	std::string result (static_cast<size_t> (numBytes - 1), 0);
+	WideCharToMultiByte (CP_UTF8, 0, str, -1, &result[0], numBytes, nullptr, nullptr);
+	return result;
+}
+
+//------------------------------------------------------------------------
+void iterateDirectory (const std::string& path, const DirectoryEntryFunction& proc)
+{
+	WIN32_FIND_DATAW findData;
+	auto handle = FindFirstFileW (toWideString (path + "\\*").data (), &findData);
+	if (handle == INVALID_HANDLE_VALUE)
+		return;
+	do
+	{
+		proc (toUTF8String (findData.cFileName),
+		      (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0);
+	} while (FindNextFileW (handle, &findData));
+	FindClose (handle);
+}
+
+#else
+//------------------------------------------------------------------------
+void iterateDirectory (const std::string& path, const DirectoryEntryFunction& proc)
+{
+	auto dir = opendir (path.data ());
+	if (!dir)
+		return;
+	while (auto entry = readdir (dir))
+	{
+		std::string name (entry->d_name);
+		// not all file systems report the type, symlinks are followed
+		bool isDirectory = entry->d_type == DT_DIR;
+		if (entry->d_type == DT_UNKNOWN || entry->d_type == DT_LNK)
+		{
+			struct stat status;
+			isDirectory =
+			    stat ((path + '/' + name).data (), &status) == 0 && S_ISDIR (status.st_mode);
+		}
+		proc (name, isDirectory);
+	}
+	closedir (dir);
+}
+#endif
+
+//------------------------------------------------------------------------
+int64_t getFileModificationTime (const std::string& path)
+{
+#if WINDOWS
+	struct _stat64 status;
+	if (_wstat64 (toWideString (path).data (), &status) != 0)
+		return 0;
+#else
+	struct stat status;
+	if (stat (path.data (), &status) != 0)
+		return 0;
+#endif
+	return static_cast<int64_t> (status.st_mtime);
+}
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
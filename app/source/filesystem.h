@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#pragma once
+
+#include "vstgui/lib/vstguibase.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+#if WINDOWS
+constexpr auto PathDelimiter = '\\';
+
+/** converts an UTF-8 string for the wide character API of Windows */
+std::wstring toWideString (const std::string& str);
+/** converts a zero terminated string of the wide character API of Windows to UTF-8 */
+std::string toUTF8String (const wchar_t* str);
+#else
+constexpr auto PathDelimiter = '/';
+#endif
+
+//------------------------------------------------------------------------
+/** returns the modification time of the file in seconds since the epoch or 0 if the file does
+ *	not exist */
+int64_t getFileModificationTime (const std::string& path);
+
+using DirectoryEntryFunction = std::function<void (const std::string& name, bool isDirectory)>;
+
+/** calls proc with the name of each entry of the directory and whether it is a directory */
+void iterateDirectory (const std::string& path, const DirectoryEntryFunction& proc);
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
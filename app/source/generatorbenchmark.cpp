@@ -0,0 +1,301 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#include "generatorbenchmark.h"
+#include "vstgui/lib/vstguibase.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+namespace {
+
+constexpr auto ExtraGeneratorSeparator = " - ";
+
+// generators for toolchains which are hardly ever installed for plug-in development
+const std::initializer_list<const char*> skippedGenerators = {
+    "Borland Makefiles",
+    "Green Hills MULTI",
+    "Watcom WMake",
+#if !WINDOWS
+    "MinGW Makefiles",
+    "MSYS Makefiles",
+    "NMake Makefiles",
+    "NMake Makefiles JOM",
+#endif
+};
+
+//------------------------------------------------------------------------
+std::string formatSeconds (double seconds)
+{
+	char buffer[32];
+	snprintf (buffer, sizeof (buffer), "%.1f s", seconds);
+	return buffer;
+}
+
+//------------------------------------------------------------------------
+std::string makePath (const std::string& dir, const std::string& name)
+{
+	auto path = dir;
+	if (!path.empty () && *path.rbegin () != '/' && *path.rbegin () != '\\')
+		path += '/';
+	return path + name;
+}
+
+//------------------------------------------------------------------------
+std::string makeTimestamp ()
+{
+	auto now = std::time (nullptr);
+	char buffer[32];
+	if (std::strftime (buffer, sizeof (buffer), "%Y-%m-%d %H:%M:%S", std::localtime (&now)) == 0)
+		return {};
+	return buffer;
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+std::shared_ptr<GeneratorBenchmark> GeneratorBenchmark::create (Settings&& settings)
+{
+	return std::shared_ptr<GeneratorBenchmark> (new GeneratorBenchmark (std::move (settings)));
+}
+
+//------------------------------------------------------------------------
+GeneratorBenchmark::GeneratorBenchmark (Settings&& s) : settings (std::move (s))
+{
+	Step removeStep;
+	removeStep.arguments.add ("-E");
+	removeStep.arguments.add ("remove_directory");
+	removeStep.arguments.addPath (settings.workDir);
+	steps.emplace_back (std::move (removeStep));
+
+	Step generateStep;
+	generateStep.phase = Phase::Generate;
+	generateStep.arguments = settings.generateArguments;
+	generateStep.arguments.mergeErrorOutput = true;
+	steps.emplace_back (std::move (generateStep));
+
+	for (const auto& generator : settings.generators)
+	{
+		auto buildDir = makePath (settings.workDir, "build-" + std::to_string (results.size ()));
+
+		Step configureStep;
+		configureStep.phase = Phase::Configure;
+		configureStep.resultIndex = results.size ();
+		configureStep.arguments.add ("-G");
+		configureStep.arguments.addPath (generator);
+		configureStep.arguments.add ("-S");
+		configureStep.arguments.addPath (settings.projectDir);
+		configureStep.arguments.add ("-B");
+		configureStep.arguments.addPath (buildDir);
+		for (const auto& arg : settings.configureArguments.args)
+			configureStep.arguments.args.emplace_back (arg);
+		configureStep.arguments.mergeErrorOutput = true;
+		steps.emplace_back (std::move (configureStep));
+
+		Step buildStep;
+		buildStep.phase = Phase::Build;
+		buildStep.resultIndex = results.size ();
+		buildStep.arguments.add ("--build");
+		buildStep.arguments.addPath (buildDir);
+		if (settings.buildJobs > 0)
+		{
+			buildStep.arguments.add ("--parallel");
+			buildStep.arguments.add (std::to_string (settings.buildJobs));
+		}
+		buildStep.arguments.mergeErrorOutput = true;
+		steps.emplace_back (std::move (buildStep));
+
+		Result result;
+		result.generator = generator;
+		results.emplace_back (std::move (result));
+	}
+}
+
+//------------------------------------------------------------------------
+bool GeneratorBenchmark::start (OutputFunction&& outputFunc, FinishFunction&& finishFunc)
+{
+	output = std::move (outputFunc);
+	finishFunction = std::move (finishFunc);
+	nextStep = 0;
+	if (!Process::create (settings.cmakePath))
+		return false;
+	runNextStep ();
+	return true;
+}
+
+//------------------------------------------------------------------------
+void GeneratorBenchmark::runNextStep ()
+{
+	// a generator which failed to configure is not built
+	while (nextStep < steps.size () && steps[nextStep].phase == Phase::Build &&
+	       !results[steps[nextStep].resultIndex].succeeded)
+		++nextStep;
+	if (nextStep >= steps.size ())
+	{
+		finish ();
+		return;
+	}
+
+	const auto& step = steps[nextStep++];
+	if (step.phase == Phase::Configure)
+		output ("\nBenchmarking " + results[step.resultIndex].generator + "\n");
+	std::string commandLine = "\n" + settings.cmakePath;
+	for (const auto& arg : step.arguments.args)
+		commandLine += " " + arg;
+	output (commandLine + "\n");
+
+	auto process = Process::create (settings.cmakePath);
+	auto startTime = Clock::now ();
+	auto self = shared_from_this ();
+	auto result = process && process->run (step.arguments, [self, &step, startTime, process] (
+	                                                           Process::CallbackParams& p) mutable {
+		if (!p.buffer.empty ())
+			self->output (std::string (p.buffer.data (), p.buffer.size ()));
+		if (p.isEOF)
+		{
+			std::chrono::duration<double> elapsed = Clock::now () - startTime;
+			self->onStepFinished (step, p.resultCode == 0, elapsed.count ());
+			process.reset ();
+		}
+	});
+	if (!result)
+		onStepFinished (step, false, 0.);
+}
+
+//------------------------------------------------------------------------
+void GeneratorBenchmark::onStepFinished (const Step& step, bool succeeded, double seconds)
+{
+	switch (step.phase)
+	{
+		case Phase::Prepare: break;
+		case Phase::Generate:
+		{
+			// without the sample project there is nothing to benchmark
+			if (!succeeded)
+			{
+				results.clear ();
+				nextStep = steps.size ();
+			}
+			break;
+		}
+		case Phase::Configure:
+		{
+			results[step.resultIndex].succeeded = succeeded;
+			results[step.resultIndex].configureSeconds = seconds;
+			break;
+		}
+		case Phase::Build:
+		{
+			results[step.resultIndex].succeeded = succeeded;
+			results[step.resultIndex].buildSeconds = seconds;
+			break;
+		}
+	}
+	runNextStep ();
+}
+
+//------------------------------------------------------------------------
+void GeneratorBenchmark::finish ()
+{
+	if (finishFunction)
+		finishFunction (results);
+	finishFunction = nullptr;
+	output = nullptr;
+}
+
+//------------------------------------------------------------------------
+std::vector<std::string> GeneratorBenchmark::selectGenerators (
+    const std::vector<std::string>& names)
+{
+	std::vector<std::string> result;
+	for (const auto& name : names)
+	{
+		if (name.find (ExtraGeneratorSeparator) != std::string::npos)
+			continue;
+		if (std::find (skippedGenerators.begin (), skippedGenerators.end (), name) !=
+		    skippedGenerators.end ())
+			continue;
+		result.emplace_back (name);
+	}
+	return result;
+}
+
+//------------------------------------------------------------------------
+std::string GeneratorBenchmark::makeReport (const Results& results)
+{
+	auto sorted = results;
+	std::stable_sort (sorted.begin (), sorted.end (), [] (const Result& lhs, const Result& rhs) {
+		if (lhs.succeeded != rhs.succeeded)
+			return lhs.succeeded;
+		return lhs.configureSeconds + lhs.buildSeconds < rhs.configureSeconds + rhs.buildSeconds;
+	});
+
+	size_t nameWidth = 0;
+	for (const auto& result : sorted)
+		nameWidth = std::max (nameWidth, result.generator.size ());
+
+	std::string report = "\nGenerator benchmark (configure + build = total):\n";
+	for (const auto& result : sorted)
+	{
+		report += "  " + result.generator + std::string (nameWidth - result.generator.size (), ' ');
+		if (result.succeeded)
+		{
+			report += "  " + formatSeconds (result.configureSeconds) + " + " +
+			          formatSeconds (result.buildSeconds) + " = " +
+			          formatSeconds (result.configureSeconds + result.buildSeconds) + "\n";
+		}
+		else
+			report += "  failed\n";
+	}
+	return report;
+}
+
+//------------------------------------------------------------------------
+bool GeneratorBenchmark::appendToCSVFile (const std::string& path, const Results& results)
+{
+	bool isNewFile = !std::ifstream (path).good ();
+	std::ofstream stream (path, std::ios::out | std::ios::app);
+	if (!stream.is_open ())
+		return false;
+	if (isNewFile)
+		stream << "time,generator,succeeded,configure seconds,build seconds\n";
+	auto timestamp = makeTimestamp ();
+	stream << std::fixed << std::setprecision (2);
+	for (const auto& result : results)
+	{
+		stream << timestamp << ",\"" << result.generator << "\","
+		       << (result.succeeded ? "yes" : "no") << "," << result.configureSeconds << ","
+		       << result.buildSeconds << "\n";
+	}
+	return stream.good ();
+}
+
+//------------------------------------------------------------------------
+auto GeneratorBenchmark::findFastest (const Results& results) -> const Result*
+{
+	const Result* fastest = nullptr;
+	for (const auto& result : results)
+	{
+		if (!result.succeeded)
+			continue;
+		if (!fastest || result.configureSeconds + result.buildSeconds <
+		                    fastest->configureSeconds + fastest->buildSeconds)
+			fastest = &result;
+	}
+	return fastest;
+}
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#pragma once
+
+#include "process.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+/** Configures and builds a generated sample project with each generator and measures the times.
+ *
+ *	The steps run one after the other: the work folder is removed, the sample project is
+ *	generated into it and then each generator configures the project into its own build folder
+ *	and builds it. A generator failing to configure or build does not stop the benchmark.
+ */
+class GeneratorBenchmark : public std::enable_shared_from_this<GeneratorBenchmark>
+{
+public:
+	struct Settings
+	{
+		std::string cmakePath;
+		/** removed before the benchmark starts */
+		std::string workDir;
+		/** the arguments of the generator script, it has to generate the project into
+		 *	projectDir */
+		Process::ArgumentList generateArguments;
+		std::string projectDir;
+		/** additional arguments for configuring the project */
+		Process::ArgumentList configureArguments;
+		std::vector<std::string> generators;
+		/** 0 if cmake does not support --parallel */
+		uint32_t buildJobs {0};
+	};
+
+	struct Result
+	{
+		std::string generator;
+		bool succeeded {false};
+		double configureSeconds {0.};
+		double buildSeconds {0.};
+	};
+	using Results = std::vector<Result>;
+
+	using OutputFunction = std::function<void (const std::string&)>;
+	using FinishFunction = std::function<void (const Results&)>;
+
+	static std::shared_ptr<GeneratorBenchmark> create (Settings&& settings);
+
+	/** the finish function is called when all steps are done or the project could not be
+	 *	generated, then the results are empty */
+	bool start (OutputFunction&& output, FinishFunction&& finish);
+
+	/** the generators worth benchmarking, extra generators only differ in the IDE files */
+	static std::vector<std::string> selectGenerators (const std::vector<std::string>& names);
+	/** the successful generators sorted by their total time, followed by the failed ones */
+	static std::string makeReport (const Results& results);
+	/** appends the results as CSV lines to the file, a header is written to a new file */
+	static bool appendToCSVFile (const std::string& path, const Results& results);
+	/** the successful generator with the shortest total time, nullptr if there is none */
+	static const Result* findFastest (const Results& results);
+
+private:
+	enum class Phase
+	{
+		Prepare,
+		Generate,
+		Configure,
+		Build,
+	};
+
+	struct Step
+	{
+		Phase phase {Phase::Prepare};
+		size_t resultIndex {0};
+		Process::ArgumentList arguments;
+	};
+
+	using Clock = std::chrono::steady_clock;
+
+	GeneratorBenchmark (Settings&& settings);
+	void runNextStep ();
+	void onStepFinished (const Step& step, bool succeeded, double seconds);
+	void finish ();
+
+	Settings settings;
+	std::vector<Step> steps;
+	size_t nextStep {0};
+	Results results;
+	OutputFunction output;
+	FinishFunction finishFunction;
+};
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
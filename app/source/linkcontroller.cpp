@@ -3,59 +3,25 @@
 
 #include "linkcontroller.h"
 
-#include "include/rapidjson/document.h"
-#include "vstgui/lib/malloc.h"
-#include "vstgui/standalone/include/iapplication.h"
-#include "vstgui/standalone/include/icommondirectories.h"
-#include "vstgui/uidescription/cstream.h"
+// generated at build time from resource/links.json
+#include "linktable.h"
 
 //------------------------------------------------------------------------
 namespace Steinberg {
 namespace Vst {
 namespace ProjectCreator {
 
-using namespace VSTGUI::Standalone;
-using namespace VSTGUI;
-
 //------------------------------------------------------------------------
 LinkController::LinkController ()
 {
-	auto path = IApplication::instance ().getCommonDirectories ().get (
-	    CommonDirectoryLocation::AppResourcesPath);
-	if (!path)
-		return;
-
-	*path += "links.json";
-	CFileStream fs;
-	if (!fs.open (path->data (), CFileStream::kReadMode))
-		return;
-	auto fileSize = fs.seek (0, SeekableStream::SeekMode::kSeekEnd);
-	fs.seek (0, SeekableStream::SeekMode::kSeekSet);
-
-	Buffer<char> buffer (fileSize);
-	fs.readRaw (buffer.data (), static_cast<uint32_t> (buffer.size ()));
-
-	try
-	{
-		using namespace rapidjson;
-		Document doc;
-		doc.Parse (buffer.data (), buffer.size ());
-		for (const auto& value : doc.GetArray ())
-		{
-			auto title = UTF8String (value["title"].GetString ());
-			auto url = value["url"].GetString ();
-			if (!title.empty () && url)
-			{
-				title += UTF8String (" -> ") + url;
-				titles.emplace_back (title);
-				urls.emplace_back (url);
-			}
-		}
-	}
-	catch (...)
+	titles.reserve (linkTable.size ());
+	urls.reserve (linkTable.size ());
+	for (const auto& link : linkTable)
 	{
-		titles.clear ();
-		urls.clear ();
+		auto title = UTF8String (link.title);
+		title += UTF8String (" -> ") + link.url;
+		titles.emplace_back (std::move (title));
+		urls.emplace_back (link.url);
 	}
 }
 
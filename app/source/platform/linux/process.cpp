@@ -7,7 +7,11 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <errno.h>
+#include <fcntl.h>
 #include <stdio.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 //------------------------------------------------------------------------
 namespace Steinberg {
@@ -28,6 +32,35 @@ struct Process::Impl
 		if (handle)
 			pclose (handle);
 	}
+
+	/** reads everything the process has written so far without blocking */
+	bool readAvailable (std::vector<char>& buffer)
+	{
+		constexpr size_t kBufferSize = 4096;
+		char plainBuffer[kBufferSize];
+		while (true)
+		{
+			auto numBytes = read (fileno (handle), plainBuffer, kBufferSize);
+			if (numBytes > 0)
+			{
+				buffer.insert (buffer.end (), plainBuffer, plainBuffer + numBytes);
+				continue;
+			}
+			if (numBytes < 0 && errno == EINTR)
+				continue;
+			// no more data for now, or the pipe was closed (numBytes == 0)
+			return numBytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+		}
+	}
+
+	int close ()
+	{
+		auto status = pclose (handle);
+		handle = nullptr;
+		if (status == -1 || !WIFEXITED (status))
+			return -1;
+		return WEXITSTATUS (status);
+	}
 };
 
 //------------------------------------------------------------------------
@@ -61,31 +94,37 @@ bool Process::run (const ArgumentList& arguments, CallbackFunction&& callback)
 	while (++it != arguments.args.end ())
 		commandLine += " " + *it;
 
-	// Construct the full command, e.g. "/usr/bin/cmake -E capabilities"
-	const std::string command = appPath + commandLine;
-
-	pImpl->handle = popen (command.data(), "r");
-	pImpl->timer = makeOwned<CVSTGUITimer> ([&, this] (CVSTGUITimer* timer) {
-		Process::CallbackParams params;
-		
-		constexpr size_t kBufferSize = 256;
-		char plainBuffer[kBufferSize] = {0};
-		if (fgets (plainBuffer, sizeof (plainBuffer), pImpl->handle) != NULL)
-		{
-			// plainBuffer[255] is '\0', hence -1
-			params.buffer.assign (std::begin (plainBuffer), std::end (plainBuffer) - 1);
-		}
-		else
-		{
-			params.isEOF = true;
-			params.resultCode = 0;
-		}
-
-		if (params.isEOF)
-			timer->stop ();
-		if (!params.buffer.empty () || params.isEOF)
-			pImpl->callback (params);
-	});
+	// Construct the full command, e.g. "/usr/bin/cmake --build build 2>&1"
+	std::string command = appPath + commandLine;
+	if (arguments.mergeErrorOutput)
+		command += " 2>&1";
+
+	pImpl->handle = popen (command.data (), "r");
+	if (!pImpl->handle)
+		return false;
+	// the pipe is polled from the timer, reading must not block the UI
+	auto fd = fileno (pImpl->handle);
+	fcntl (fd, F_SETFL, fcntl (fd, F_GETFL) | O_NONBLOCK);
+
+	// build output comes in bursts, poll often enough to show it while it is produced
+	constexpr uint32_t kPollInterval = 20;
+	pImpl->timer = makeOwned<CVSTGUITimer> (
+	    [this] (CVSTGUITimer* timer) {
+		    Process::CallbackParams params;
+		    params.isEOF = !pImpl->readAvailable (params.buffer);
+		    if (params.isEOF)
+		    {
+			    timer->stop ();
+			    params.resultCode = pImpl->close ();
+			    // the callback may release the last reference to this process
+			    auto callback = std::move (pImpl->callback);
+			    callback (params);
+			    return;
+		    }
+		    if (!params.buffer.empty ())
+			    pImpl->callback (params);
+	    },
+	    kPollInterval);
 
 	return true;
 }
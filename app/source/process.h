@@ -29,6 +29,9 @@ public:
 		void addPath (const std::string& str);
 
 		std::vector<std::string> args;
+		/** the error output is passed to the callback as well, for output which is only shown.
+		 *	On Windows the error output is always passed. */
+		bool mergeErrorOutput {false};
 	};
 
 	using CallbackFunction = std::function<void (CallbackParams&)>;
@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#include "startuptrace.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+namespace {
+
+constexpr auto StartupTraceEnvVariable = "VST3_PROJECT_GENERATOR_STARTUP_TRACE";
+
+// initialized while the static objects of the app are constructed, which is as near to the
+// process start as we can get without platform specific code
+const auto gLaunchTime = StartupTrace::Clock::now ();
+
+//------------------------------------------------------------------------
+int64_t toMicroseconds (StartupTrace::Clock::time_point time)
+{
+	return std::chrono::duration_cast<std::chrono::microseconds> (time - gLaunchTime).count ();
+}
+
+//------------------------------------------------------------------------
+void writeTraceEvent (std::ofstream& stream, const char* name, StartupTrace::Clock::time_point start,
+                      StartupTrace::Clock::time_point end)
+{
+	stream << R"({"name":")" << name << R"(","cat":"startup","ph":"X","pid":1,"tid":1,"ts":)"
+	       << toMicroseconds (start) << R"(,"dur":)" << (toMicroseconds (end) - toMicroseconds (start))
+	       << "}";
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+StartupTrace::StartupTrace ()
+{
+	if (auto path = std::getenv (StartupTraceEnvVariable))
+		tracePath = path;
+}
+
+//------------------------------------------------------------------------
+StartupTrace& StartupTrace::instance ()
+{
+	static StartupTrace gInstance;
+	return gInstance;
+}
+
+//------------------------------------------------------------------------
+void StartupTrace::addPhase (const char* name, Clock::time_point start, Clock::time_point end)
+{
+	if (!isEnabled ())
+		return;
+	phases.push_back ({name, start, end});
+}
+
+//------------------------------------------------------------------------
+void StartupTrace::finish ()
+{
+	if (!isEnabled ())
+		return;
+	finished = true;
+
+	std::ofstream stream (tracePath, std::ios::out | std::ios::trunc);
+	if (!stream.is_open ())
+		return;
+	stream << R"({"traceEvents":[)";
+	writeTraceEvent (stream, "Launch To First Frame", gLaunchTime, Clock::now ());
+	for (const auto& phase : phases)
+	{
+		stream << ",\n";
+		writeTraceEvent (stream, phase.name, phase.start, phase.end);
+	}
+	stream << "]}\n";
+	phases.clear ();
+}
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+/** Collects the timings of the startup phases of the app.
+ *
+ *	Tracing is only active if the environment variable
+ *	VST3_PROJECT_GENERATOR_STARTUP_TRACE contains the path of the trace file to write. The file
+ *	uses the Chrome trace event format and can be opened with chrome://tracing or Perfetto.
+ */
+class StartupTrace
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static StartupTrace& instance ();
+
+	bool isEnabled () const { return !tracePath.empty () && !finished; }
+
+	void addPhase (const char* name, Clock::time_point start, Clock::time_point end);
+	/** mark the first frame as done and write the trace file */
+	void finish ();
+
+private:
+	StartupTrace ();
+
+	struct Phase
+	{
+		const char* name;
+		Clock::time_point start;
+		Clock::time_point end;
+	};
+
+	std::string tracePath;
+	std::vector<Phase> phases;
+	bool finished {false};
+};
+
+//------------------------------------------------------------------------
+class StartupTraceScope
+{
+public:
+	explicit StartupTraceScope (const char* name) : name (name)
+	{
+		if (StartupTrace::instance ().isEnabled ())
+			start = StartupTrace::Clock::now ();
+	}
+	~StartupTraceScope () noexcept
+	{
+		if (StartupTrace::instance ().isEnabled ())
+			StartupTrace::instance ().addPhase (name, start, StartupTrace::Clock::now ());
+	}
+
+private:
+	const char* name;
+	StartupTrace::Clock::time_point start {};
+};
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#include "timetrace.h"
+#include "filesystem.h"
+#include "vstgui/lib/vstguibase.h"
+#include "include/rapidjson/document.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+namespace {
+
+// cmake writes the object files and clang the traces next to them into
+// CMakeFiles/<target>.dir/<source path>.json
+constexpr auto TargetDirectoryMarker = "CMakeFiles";
+constexpr auto TraceFileExtension = ".json";
+
+constexpr auto EventUnit = "ExecuteCompiler";
+constexpr auto EventSource = "Source";
+constexpr auto EventInstantiateClass = "InstantiateClass";
+constexpr auto EventInstantiateFunction = "InstantiateFunction";
+
+//------------------------------------------------------------------------
+bool endsWith (const std::string& str, const char* suffix)
+{
+	auto length = strlen (suffix);
+	return str.size () >= length && str.compare (str.size () - length, length, suffix) == 0;
+}
+
+//------------------------------------------------------------------------
+/** collects the trace files below dir, relativePath is the path of dir in the build folder */
+void findTraceFiles (const std::string& dir, const std::string& relativePath,
+                     bool inTargetDirectory, std::vector<std::string>& result)
+{
+	iterateDirectory (dir, [&] (const std::string& name, bool isDirectory) {
+		if (name.empty () || name[0] == '.')
+			return;
+		auto path = dir + PathDelimiter + name;
+		auto relative = relativePath.empty () ? name : relativePath + '/' + name;
+		if (isDirectory)
+			findTraceFiles (path, relative, inTargetDirectory || name == TargetDirectoryMarker,
+			                result);
+		else if (inTargetDirectory && endsWith (name, TraceFileExtension))
+			result.push_back (relative);
+	});
+}
+
+//------------------------------------------------------------------------
+void addEntry (TimeTraceSummary::EntryMap& map, const std::string& name, double seconds)
+{
+	auto& entry = map[name];
+	entry.seconds += seconds;
+	++entry.count;
+}
+
+//------------------------------------------------------------------------
+std::string formatSeconds (double seconds)
+{
+	char buffer[32];
+	snprintf (buffer, sizeof (buffer), "%7.1f s", seconds);
+	return buffer;
+}
+
+//------------------------------------------------------------------------
+void appendEntries (std::string& report, const char* title, const TimeTraceSummary::EntryMap& map,
+                    size_t maxEntries, bool withCount)
+{
+	using EntryRef = std::pair<const std::string*, TimeTraceSummary::Entry>;
+	std::vector<EntryRef> entries;
+	entries.reserve (map.size ());
+	for (const auto& it : map)
+		entries.emplace_back (&it.first, it.second);
+	auto numEntries = std::min (maxEntries, entries.size ());
+	std::partial_sort (entries.begin (), entries.begin () + numEntries, entries.end (),
+	                   [] (const EntryRef& a, const EntryRef& b) {
+		                   return a.second.seconds > b.second.seconds;
+	                   });
+
+	report += title;
+	report += "\n";
+	for (size_t index = 0; index < numEntries; ++index)
+	{
+		const auto& entry = entries[index];
+		report += "  " + formatSeconds (entry.second.seconds);
+		if (withCount)
+		{
+			char buffer[16];
+			snprintf (buffer, sizeof (buffer), "%6ux", entry.second.count);
+			report += buffer;
+		}
+		report += "  " + *entry.first + "\n";
+	}
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+uint32_t TimeTraceSummary::addBuildDirectory (const std::string& buildDir,
+                                              int64_t minModificationTime)
+{
+	std::vector<std::string> files;
+	findTraceFiles (buildDir, {}, false, files);
+	uint32_t numAdded = 0;
+	for (const auto& file : files)
+	{
+		auto path = buildDir + PathDelimiter + file;
+		if (minModificationTime > 0 && getFileModificationTime (path) < minModificationTime)
+			continue;
+		auto unitName = file.substr (0, file.size () - strlen (TraceFileExtension));
+		if (addTraceFile (path, unitName))
+			++numAdded;
+	}
+	return numAdded;
+}
+
+//------------------------------------------------------------------------
+bool TimeTraceSummary::addTraceFile (const std::string& path, const std::string& unitName)
+{
+	std::ifstream stream (path, std::ios::in | std::ios::binary);
+	if (!stream.is_open ())
+		return false;
+	std::ostringstream content;
+	content << stream.rdbuf ();
+	return addTrace (content.str (), unitName);
+}
+
+//------------------------------------------------------------------------
+bool TimeTraceSummary::addTrace (const std::string& json, const std::string& unitName)
+{
+	rapidjson::Document doc;
+	doc.Parse (json.data (), json.size ());
+	if (doc.HasParseError () || !doc.IsObject ())
+		return false;
+	auto events = doc.FindMember ("traceEvents");
+	if (events == doc.MemberEnd () || !events->value.IsArray ())
+		return false;
+
+	for (const auto& event : events->value.GetArray ())
+	{
+		if (!event.IsObject ())
+			continue;
+		auto name = event.FindMember ("name");
+		auto duration = event.FindMember ("dur");
+		if (name == event.MemberEnd () || !name->value.IsString () ||
+		    duration == event.MemberEnd () || !duration->value.IsNumber ())
+			continue;
+		auto seconds = duration->value.GetDouble () / 1000000.;
+		const char* eventName = name->value.GetString ();
+		if (strcmp (eventName, EventUnit) == 0)
+		{
+			addEntry (units, unitName, seconds);
+			continue;
+		}
+
+		auto args = event.FindMember ("args");
+		if (args == event.MemberEnd () || !args->value.IsObject ())
+			continue;
+		auto detail = args->value.FindMember ("detail");
+		if (detail == args->value.MemberEnd () || !detail->value.IsString ())
+			continue;
+		if (strcmp (eventName, EventSource) == 0)
+			addEntry (headers, detail->value.GetString (), seconds);
+		else if (strcmp (eventName, EventInstantiateClass) == 0 ||
+		         strcmp (eventName, EventInstantiateFunction) == 0)
+			addEntry (templates, collapseTemplateArguments (detail->value.GetString ()), seconds);
+	}
+	++numTraces;
+	return true;
+}
+
+//------------------------------------------------------------------------
+std::string TimeTraceSummary::makeReport (size_t maxEntries) const
+{
+	std::string report;
+	if (numTraces == 0)
+		return report;
+	report += "\nCompile time trace of " + std::to_string (numTraces) + " translation units\n";
+	appendEntries (report, "Most expensive translation units:", units, maxEntries, false);
+	appendEntries (report, "Most expensive headers (inclusive time, number of includes):",
+	               headers, maxEntries, true);
+	appendEntries (report,
+	               "Most expensive templates (inclusive time, number of instantiations):",
+	               templates, maxEntries, true);
+	return report;
+}
+
+//------------------------------------------------------------------------
+std::string TimeTraceSummary::collapseTemplateArguments (const std::string& name)
+{
+	std::string result;
+	result.reserve (name.size ());
+	int depth = 0;
+	for (auto c : name)
+	{
+		if (c == '<')
+		{
+			if (depth++ == 0)
+				result += "<$";
+		}
+		else if (c == '>' && depth > 0)
+		{
+			if (--depth == 0)
+				result += c;
+		}
+		else if (depth == 0)
+			result += c;
+	}
+	return result;
+}
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
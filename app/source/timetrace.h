@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+/** Merges the compile time traces written by clang's -ftime-trace for each translation unit
+ *	into a summary of the most expensive translation units, headers and template instantiations.
+ *
+ *	The times of headers and templates are inclusive, a header includes the time of the headers
+ *	it includes and an instantiation the time of the instantiations it triggers.
+ */
+class TimeTraceSummary
+{
+public:
+	/** adds all traces found in the CMakeFiles folders below the build folder, returns the number
+	 *	of traces added. Traces older than minModificationTime (see getFileModificationTime) are
+	 *	left from earlier builds and skipped. */
+	uint32_t addBuildDirectory (const std::string& buildDir, int64_t minModificationTime = 0);
+	/** adds the trace file of one translation unit */
+	bool addTraceFile (const std::string& path, const std::string& unitName);
+	/** adds the JSON content of a trace file */
+	bool addTrace (const std::string& json, const std::string& unitName);
+
+	uint32_t getNumTraces () const { return numTraces; }
+
+	/** the report lists at most maxEntries entries per category */
+	std::string makeReport (size_t maxEntries) const;
+
+	/** replaces the template arguments of an instantiation by "$", so all instantiations of a
+	 *	template are summed up */
+	static std::string collapseTemplateArguments (const std::string& name);
+
+	struct Entry
+	{
+		double seconds {0.};
+		uint32_t count {0};
+	};
+	using EntryMap = std::unordered_map<std::string, Entry>;
+
+private:
+	EntryMap units;
+	EntryMap headers;
+	EntryMap templates;
+	uint32_t numTraces {0};
+};
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
@@ -0,0 +1,279 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#include "vstsdkindex.h"
+#include "filesystem.h"
+#include "include/rapidjson/document.h"
+#include "include/rapidjson/stringbuffer.h"
+#include "include/rapidjson/writer.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+namespace {
+
+constexpr auto VersionHeader = "pluginterfaces/vst/vsttypes.h";
+constexpr auto SamplesCMakeLists = "public.sdk/samples/vst/CMakeLists.txt";
+constexpr auto VSTGUIEditorHeader = "vstgui4/vstgui/plugin-bindings/vst3editor.h";
+
+// the files the generated projects need, most of them are in git submodules of the SDK
+const std::initializer_list<const char*> requiredFiles = {
+    "CMakeLists.txt",
+    "cmake/modules/SMTG_VST3_SDK.cmake",
+    "base/source/fobject.h",
+    VersionHeader,
+    "public.sdk/source/vst/vstaudioeffect.h",
+    "public.sdk/source/main/pluginfactory.h",
+};
+
+//------------------------------------------------------------------------
+std::string makePath (const std::string& sdkPath, const char* relativePath)
+{
+	auto path = sdkPath;
+	if (!path.empty () && *path.rbegin () != '/' && *path.rbegin () != '\\')
+		path += '/';
+	path += relativePath;
+	return path;
+}
+
+//------------------------------------------------------------------------
+bool exists (const std::string& path)
+{
+	return getFileModificationTime (path) != 0;
+}
+
+// the folders of the git submodules, checking one out changes the modification time of its folder
+const std::initializer_list<const char*> submoduleFolders = {
+    "base",
+    "cmake",
+    "pluginterfaces",
+    "public.sdk",
+    "vstgui4",
+};
+
+//------------------------------------------------------------------------
+/** combines the modification times of everything the index is built from, a file which is
+ *	added or removed changes it as well */
+int64_t calcFingerprint (const std::string& sdkPath)
+{
+	uint64_t fingerprint = static_cast<uint64_t> (getFileModificationTime (sdkPath));
+	auto add = [&] (const char* relativePath) {
+		auto time = getFileModificationTime (makePath (sdkPath, relativePath));
+		fingerprint = fingerprint * 31u + static_cast<uint64_t> (time);
+	};
+	for (auto folder : submoduleFolders)
+		add (folder);
+	for (auto file : requiredFiles)
+		add (file);
+	add (VSTGUIEditorHeader);
+	add (SamplesCMakeLists);
+	return static_cast<int64_t> (fingerprint);
+}
+
+//------------------------------------------------------------------------
+bool isStringArray (const rapidjson::Value& value)
+{
+	if (!value.IsArray ())
+		return false;
+	for (const auto& element : value.GetArray ())
+	{
+		if (!element.IsString ())
+			return false;
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool readFile (const std::string& path, std::string& content)
+{
+	std::ifstream stream (path, std::ios::in | std::ios::binary);
+	if (!stream.is_open ())
+		return false;
+	content.assign (std::istreambuf_iterator<char> (stream), std::istreambuf_iterator<char> ());
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool findDefineValue (const std::string& source, const char* name, int32_t& value)
+{
+	auto define = std::string ("#define ") + name;
+	auto pos = source.find (define);
+	if (pos == std::string::npos)
+		return false;
+	auto valueStart = source.data () + pos + define.size ();
+	char* valueEnd = nullptr;
+	value = static_cast<int32_t> (std::strtol (valueStart, &valueEnd, 10));
+	return valueEnd != valueStart;
+}
+
+//------------------------------------------------------------------------
+void parseVersion (VSTSDKIndex& index)
+{
+	std::string source;
+	if (!readFile (makePath (index.path, VersionHeader), source))
+		return;
+	if (!findDefineValue (source, "kVstVersionMajor", index.versionMajor) ||
+	    !findDefineValue (source, "kVstVersionMinor", index.versionMinor) ||
+	    !findDefineValue (source, "kVstVersionSub", index.versionSub))
+		return;
+	index.version = std::to_string (index.versionMajor) + "." +
+	                std::to_string (index.versionMinor) + "." + std::to_string (index.versionSub);
+}
+
+//------------------------------------------------------------------------
+void parseSamples (VSTSDKIndex& index)
+{
+	std::string source;
+	if (!readFile (makePath (index.path, SamplesCMakeLists), source))
+		return;
+	std::istringstream input (source);
+	std::string line;
+	while (std::getline (input, line))
+	{
+		auto pos = line.find ("add_subdirectory(");
+		if (pos == std::string::npos || line.find ('#') < pos)
+			continue;
+		pos += strlen ("add_subdirectory(");
+		auto end = line.find_first_of (" )", pos);
+		if (end == std::string::npos || end == pos)
+			continue;
+		index.samples.emplace_back (line.substr (pos, end - pos));
+	}
+}
+
+//------------------------------------------------------------------------
+bool readCacheFile (const std::string& cacheFilePath, VSTSDKIndex& index)
+{
+	std::string content;
+	if (!readFile (cacheFilePath, content))
+		return false;
+
+	using namespace rapidjson;
+	Document doc;
+	doc.Parse (content.data (), content.size ());
+	// the rapidjson getters assert the type, so a broken file has to be detected before
+	if (!doc.IsObject () || !doc.HasMember ("path") || !doc.HasMember ("fingerprint") ||
+	    !doc.HasMember ("version") || !doc.HasMember ("hasVSTGUI") ||
+	    !doc.HasMember ("samples") || !doc.HasMember ("missingFiles"))
+		return false;
+	if (!doc["path"].IsString () || !doc["fingerprint"].IsInt64 () ||
+	    !doc["hasVSTGUI"].IsBool () || !isStringArray (doc["samples"]) ||
+	    !isStringArray (doc["missingFiles"]))
+		return false;
+
+	index.path = doc["path"].GetString ();
+	index.fingerprint = doc["fingerprint"].GetInt64 ();
+	const auto& version = doc["version"];
+	if (version.IsArray () && version.Size () == 3 && version[0].IsInt () &&
+	    version[1].IsInt () && version[2].IsInt ())
+	{
+		index.versionMajor = version[0].GetInt ();
+		index.versionMinor = version[1].GetInt ();
+		index.versionSub = version[2].GetInt ();
+		index.version = std::to_string (index.versionMajor) + "." +
+		                std::to_string (index.versionMinor) + "." +
+		                std::to_string (index.versionSub);
+	}
+	index.hasVSTGUI = doc["hasVSTGUI"].GetBool ();
+	for (const auto& sample : doc["samples"].GetArray ())
+		index.samples.emplace_back (sample.GetString ());
+	for (const auto& file : doc["missingFiles"].GetArray ())
+		index.missingFiles.emplace_back (file.GetString ());
+	return true;
+}
+
+//------------------------------------------------------------------------
+void writeCacheFile (const std::string& cacheFilePath, const VSTSDKIndex& index)
+{
+	using namespace rapidjson;
+	StringBuffer buffer;
+	Writer<StringBuffer> writer (buffer);
+	writer.StartObject ();
+	writer.Key ("path");
+	writer.String (index.path.data ());
+	writer.Key ("fingerprint");
+	writer.Int64 (index.fingerprint);
+	writer.Key ("version");
+	if (index.version.empty ())
+		writer.Null ();
+	else
+	{
+		writer.StartArray ();
+		writer.Int (index.versionMajor);
+		writer.Int (index.versionMinor);
+		writer.Int (index.versionSub);
+		writer.EndArray ();
+	}
+	writer.Key ("hasVSTGUI");
+	writer.Bool (index.hasVSTGUI);
+	writer.Key ("samples");
+	writer.StartArray ();
+	for (const auto& sample : index.samples)
+		writer.String (sample.data ());
+	writer.EndArray ();
+	writer.Key ("missingFiles");
+	writer.StartArray ();
+	for (const auto& file : index.missingFiles)
+		writer.String (file.data ());
+	writer.EndArray ();
+	writer.EndObject ();
+
+	std::ofstream stream (cacheFilePath, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (stream.is_open ())
+		stream.write (buffer.GetString (), static_cast<std::streamsize> (buffer.GetSize ()));
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+
+//------------------------------------------------------------------------
+VSTSDKIndex buildVSTSDKIndex (const std::string& sdkPath)
+{
+	VSTSDKIndex index;
+	index.path = sdkPath;
+	index.fingerprint = calcFingerprint (sdkPath);
+	for (auto file : requiredFiles)
+	{
+		if (!exists (makePath (sdkPath, file)))
+			index.missingFiles.emplace_back (file);
+	}
+	parseVersion (index);
+	index.hasVSTGUI = exists (makePath (sdkPath, VSTGUIEditorHeader));
+	parseSamples (index);
+	return index;
+}
+
+//------------------------------------------------------------------------
+VSTSDKIndex getVSTSDKIndex (const std::string& sdkPath, const std::string& cacheFilePath)
+{
+	VSTSDKIndex index;
+	try
+	{
+		if (!cacheFilePath.empty () && readCacheFile (cacheFilePath, index) &&
+		    index.path == sdkPath && index.fingerprint == calcFingerprint (sdkPath))
+			return index;
+	}
+	catch (...)
+	{
+		// the cache file is broken, it will be rewritten
+	}
+
+	index = buildVSTSDKIndex (sdkPath);
+	if (!cacheFilePath.empty ())
+		writeCacheFile (cacheFilePath, index);
+	return index;
+}
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
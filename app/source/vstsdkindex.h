@@ -0,0 +1,53 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+
+//------------------------------------------------------------------------
+/** What we know about a VST SDK folder without running cmake on it. */
+struct VSTSDKIndex
+{
+	using StringList = std::vector<std::string>;
+
+	std::string path;
+	/** changes whenever the SDK folder, its submodule folders or the indexed files change */
+	int64_t fingerprint {0};
+
+	/** e.g. "3.7.7", empty if the version header could not be parsed */
+	std::string version;
+	int32_t versionMajor {0};
+	int32_t versionMinor {0};
+	int32_t versionSub {0};
+
+	bool hasVSTGUI {false};
+	/** the sample plug-ins the SDK builds */
+	StringList samples;
+	/** required files which are missing, e.g. because the git submodules were not checked out */
+	StringList missingFiles;
+
+	bool isValid () const { return missingFiles.empty (); }
+};
+
+//------------------------------------------------------------------------
+/** returns the index of the SDK, either from the cache file or by scanning the SDK folder
+ *
+ *	The cache file is updated if the SDK had to be scanned.
+ */
+VSTSDKIndex getVSTSDKIndex (const std::string& sdkPath, const std::string& cacheFilePath);
+
+/** scans the SDK folder */
+VSTSDKIndex buildVSTSDKIndex (const std::string& sdkPath);
+
+//------------------------------------------------------------------------
+} // ProjectCreator
+} // Vst
+} // Steinberg
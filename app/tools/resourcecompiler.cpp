@@ -0,0 +1,195 @@
+//------------------------------------------------------------------------
+// Flags       : clang-format SMTGSequencer
+
+// Build time tool which converts the editable resources of the app into the form shipped with
+// the app.
+//
+// usage: resourcecompiler uidesc <input.uidesc> <output.uidesc>
+//
+//   Writes the uidesc without the data only used by the UI editor and without any whitespace,
+//   so that the app has less to read and parse on startup.
+//
+// usage: resourcecompiler links <input.json> <output.h>
+//
+//   Writes the link list as a constexpr table which is compiled into the app.
+
+#include "../source/include/rapidjson/document.h"
+#include "../source/include/rapidjson/error/en.h"
+#include "../source/include/rapidjson/stringbuffer.h"
+#include "../source/include/rapidjson/writer.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+//------------------------------------------------------------------------
+namespace Steinberg {
+namespace Vst {
+namespace ProjectCreator {
+namespace {
+
+//------------------------------------------------------------------------
+bool readFile (const char* path, std::string& content)
+{
+	std::ifstream stream (path, std::ios::in | std::ios::binary);
+	if (!stream.is_open ())
+		return false;
+	content.assign (std::istreambuf_iterator<char> (stream), std::istreambuf_iterator<char> ());
+	return true;
+}
+
+//------------------------------------------------------------------------
+bool writeFile (const char* path, const char* data, size_t size)
+{
+	std::ofstream stream (path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!stream.is_open ())
+		return false;
+	stream.write (data, static_cast<std::streamsize> (size));
+	return stream.good ();
+}
+
+//------------------------------------------------------------------------
+bool parseJSON (const char* path, rapidjson::Document& doc)
+{
+	std::string content;
+	if (!readFile (path, content))
+	{
+		std::cerr << "could not read " << path << "\n";
+		return false;
+	}
+	doc.Parse (content.data (), content.size ());
+	if (doc.HasParseError ())
+	{
+		std::cerr << path << ":" << doc.GetErrorOffset () << ": "
+		          << rapidjson::GetParseError_En (doc.GetParseError ()) << "\n";
+		return false;
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------
+int compileUIDesc (const char* inputPath, const char* outputPath)
+{
+	rapidjson::Document doc;
+	if (!parseJSON (inputPath, doc))
+		return 1;
+
+	if (!doc.IsObject () || !doc.HasMember ("vstgui-ui-description"))
+	{
+		std::cerr << inputPath << ": not a vstgui ui description\n";
+		return 1;
+	}
+	auto& root = doc["vstgui-ui-description"];
+	// the custom section only holds the state of the UI editor
+	root.RemoveMember ("custom");
+
+	// Note: the document may contain the same key more than once (the view class names of the
+	// children), rapidjson keeps them all in their original order.
+	rapidjson::StringBuffer buffer;
+	rapidjson::Writer<rapidjson::StringBuffer> writer (buffer);
+	doc.Accept (writer);
+
+	if (!writeFile (outputPath, buffer.GetString (), buffer.GetSize ()))
+	{
+		std::cerr << "could not write " << outputPath << "\n";
+		return 1;
+	}
+	return 0;
+}
+
+//------------------------------------------------------------------------
+std::string makeCppStringLiteral (const char* str)
+{
+	std::string result ("\"");
+	for (auto c = reinterpret_cast<const unsigned char*> (str); *c; ++c)
+	{
+		if (*c == '"' || *c == '\\')
+		{
+			result += '\\';
+			result += static_cast<char> (*c);
+		}
+		else if (*c < 0x20 || *c >= 0x7F)
+		{
+			// octal escapes never consume the following characters, hex escapes could
+			char escaped[5];
+			std::snprintf (escaped, sizeof (escaped), "\\%03o", *c);
+			result += escaped;
+		}
+		else
+			result += static_cast<char> (*c);
+	}
+	result += '"';
+	return result;
+}
+
+//------------------------------------------------------------------------
+int compileLinks (const char* inputPath, const char* outputPath)
+{
+	rapidjson::Document doc;
+	if (!parseJSON (inputPath, doc))
+		return 1;
+
+	if (!doc.IsArray ())
+	{
+		std::cerr << inputPath << ": expected an array of links\n";
+		return 1;
+	}
+
+	std::string entries;
+	size_t numEntries = 0;
+	for (const auto& value : doc.GetArray ())
+	{
+		if (!value.IsObject () || !value.HasMember ("title") || !value.HasMember ("url") ||
+		    !value["title"].IsString () || !value["url"].IsString ())
+		{
+			std::cerr << inputPath << ": every link needs a title and an url\n";
+			return 1;
+		}
+		auto title = value["title"].GetString ();
+		auto url = value["url"].GetString ();
+		if (*title == 0 || *url == 0)
+			continue;
+		entries += "\t{" + makeCppStringLiteral (title) + ", " + makeCppStringLiteral (url) + "},\n";
+		++numEntries;
+	}
+
+	std::string header;
+	header += "// Generated by resourcecompiler from links.json, do not edit.\n\n";
+	header += "#pragma once\n\n";
+	header += "#include <array>\n\n";
+	header += "namespace Steinberg {\nnamespace Vst {\nnamespace ProjectCreator {\n\n";
+	header += "struct LinkTableEntry\n{\n\tconst char* title;\n\tconst char* url;\n};\n\n";
+	header += "constexpr std::array<LinkTableEntry, " + std::to_string (numEntries) +
+	          "> linkTable = {{\n" + entries + "}};\n\n";
+	header += "} // ProjectCreator\n} // Vst\n} // Steinberg\n";
+
+	if (!writeFile (outputPath, header.data (), header.size ()))
+	{
+		std::cerr << "could not write " << outputPath << "\n";
+		return 1;
+	}
+	return 0;
+}
+
+//------------------------------------------------------------------------
+} // anonymous
+} // ProjectCreator
+} // Vst
+} // Steinberg
+
+//------------------------------------------------------------------------
+int main (int argc, char* argv[])
+{
+	using namespace Steinberg::Vst::ProjectCreator;
+
+	if (argc == 4 && std::strcmp (argv[1], "uidesc") == 0)
+		return compileUIDesc (argv[2], argv[3]);
+	if (argc == 4 && std::strcmp (argv[1], "links") == 0)
+		return compileLinks (argv[2], argv[3]);
+
+	std::cerr << "usage: resourcecompiler uidesc|links <input> <output>\n";
+	return 1;
+}
@@ -13,6 +13,7 @@ include(SMTG_GeneratePluginUuids)
 include(SMTG_GeneratorSpecifics)
 include(SMTG_VendorSpecifics)
 include(SMTG_CodeSnippets)
+include(SMTG_PluginParameters)
 
 smtg_print_generator_copyright_header()
 smtg_check_system()
@@ -21,6 +22,8 @@ smtg_generate_plugin_uuids()
 smtg_print_generator_specifics()
 smtg_print_vendor_specifics()
 smtg_print_plugin_uuids()
+smtg_generate_plugin_parameters()
+smtg_print_plugin_parameters()
 
 # Collect all files in our template folder
 file(GLOB_RECURSE 
@@ -29,6 +32,9 @@ file(GLOB_RECURSE
     ${SMTG_TEMPLATE_FILES_PATH}
     ${SMTG_TEMPLATE_FILES_PATH}/*
 )
+if(SMTG_EXCLUDED_TEMPLATE_FILES)
+    list(REMOVE_ITEM template_files ${SMTG_EXCLUDED_TEMPLATE_FILES})
+endif()
 
 foreach(rel_input_file ${template_files})
     # Set the plug-in folder name which should be the plug-in's name
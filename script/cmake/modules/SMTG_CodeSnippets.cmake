@@ -25,3 +25,86 @@ else()
         return nullptr;"
     )
 endif(SMTG_ENABLE_VSTGUI_SUPPORT)
+
+if(NOT SMTG_PARAMETER_SMOOTHING STREQUAL "OFF")
+    if(SMTG_PARAMETER_SMOOTHING STREQUAL "LINEAR")
+        set(smoothing_mode Linear)
+    else()
+        set(smoothing_mode OnePole)
+    endif()
+    set(SMTG_INCLUDE_SMOOTHERS_HEADER_CODE_SNIPPET
+        "\n#include \"${SMTG_PREFIX_FOR_FILENAMES}smoothers.h\""
+    )
+    set(SMTG_SMOOTHERS_MEMBER_CODE_SNIPPET
+        "\n\tParamSmoothers smoothers;"
+    )
+    set(SMTG_SETUP_SMOOTHERS_CODE_SNIPPET
+        "\n\tsmoothers.setup (ParamSmoothers::Mode::${smoothing_mode}, newSetup.sampleRate,
+	                 newSetup.maxSamplesPerBlock);\n"
+    )
+    set(SMTG_ACTIVATE_SMOOTHERS_CODE_SNIPPET
+        "\n\tif (state)\n\t\tsmoothers.snapToTargets ();\n"
+    )
+    set(SMTG_SKIP_SMOOTHERS_CODE_SNIPPET
+        "\n\t\tsmoothers.snapToTargets ();"
+    )
+    set(SMTG_PROCESS_SMOOTHERS_CODE_SNIPPET
+        "\n\tsmoothers.process (numSamples);\n"
+    )
+    set(SMTG_SMOOTHERS_SOURCE_CODE_SNIPPET
+        "\n    source/${SMTG_PREFIX_FOR_FILENAMES}smoothers.h"
+    )
+endif()
+
+if(SMTG_PROCESS_64BIT_SAMPLES)
+    set(SMTG_PROCESS_AUDIO_CALL_CODE_SNIPPET
+        "if (data.symbolicSampleSize == Vst::kSample64)
+				processAudio<Vst::Sample64> (data, blockOffset, blockSamples);
+			else
+				processAudio<Vst::Sample32> (data, blockOffset, blockSamples);"
+    )
+    set(SMTG_CAN_PROCESS_SAMPLE64_CODE_SNIPPET
+        "// kSample64 is processed by processAudio<Vst::Sample64>
+	if (symbolicSampleSize == Vst::kSample64)
+		return kResultTrue;"
+    )
+else()
+    set(SMTG_PROCESS_AUDIO_CALL_CODE_SNIPPET
+        "processAudio<Vst::Sample32> (data, blockOffset, blockSamples);"
+    )
+    set(SMTG_CAN_PROCESS_SAMPLE64_CODE_SNIPPET
+        "// disable the following comment if your processing support kSample64,
+	// process calls processAudio<Vst::Sample64> for it
+	/* if (symbolicSampleSize == Vst::kSample64)
+		return kResultTrue; */"
+    )
+endif(SMTG_PROCESS_64BIT_SAMPLES)
+
+if(SMTG_SIMD_KERNELS)
+    set(SMTG_INCLUDE_SIMD_HEADER_CODE_SNIPPET
+        "\n#include \"${SMTG_PREFIX_FOR_FILENAMES}simd.h\""
+    )
+    set(SMTG_SIMD_KERNELS_MEMBER_CODE_SNIPPET
+        "\n\tSimd::Kernels kernels;"
+    )
+    set(SMTG_SELECT_SIMD_KERNELS_CODE_SNIPPET
+        "\n\tkernels.select (Simd::detectInstructionSet ());\n"
+    )
+    set(SMTG_PROCESS_GAIN_CODE_SNIPPET
+        "kernels.gain (in, out, numSamples, outputGain);"
+    )
+    set(SMTG_SIMD_SOURCE_CODE_SNIPPET
+        "\n    source/${SMTG_PREFIX_FOR_FILENAMES}simd.h\n    source/${SMTG_PREFIX_FOR_FILENAMES}simdkernels.h"
+    )
+else()
+    set(SMTG_PROCESS_GAIN_CODE_SNIPPET
+        "for (int32 sample = 0; sample < numSamples; ++sample)
+			out[sample] = in[sample] * outputGain;"
+    )
+endif(SMTG_SIMD_KERNELS)
+
+if(SMTG_DENORMAL_DC_OFFSET)
+    set(SMTG_DENORMAL_DC_OFFSET_CODE_SNIPPET "true")
+else()
+    set(SMTG_DENORMAL_DC_OFFSET_CODE_SNIPPET "false")
+endif(SMTG_DENORMAL_DC_OFFSET)
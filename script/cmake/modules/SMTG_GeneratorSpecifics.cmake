@@ -17,15 +17,169 @@ if(SMTG_VST3_SDK_SOURCE_DIR_CLI)
     string(REPLACE "\"" "" SMTG_VST3_SDK_SOURCE_DIR ${SMTG_VST3_SDK_SOURCE_DIR_CLI})
 endif(SMTG_VST3_SDK_SOURCE_DIR_CLI)
 
+# Version of the VST3 SDK as found by the app, empty if unknown.
+set(SMTG_VST3_SDK_VERSION "")
+if(SMTG_VST3_SDK_VERSION_CLI)
+    string(REPLACE "\"" "" SMTG_VST3_SDK_VERSION ${SMTG_VST3_SDK_VERSION_CLI})
+endif(SMTG_VST3_SDK_VERSION_CLI)
+
+# The templates use the cmake functions introduced with VST3 SDK 3.7.0.
+set(SMTG_VST3_SDK_MINIMUM_VERSION 3.7.0)
+if(SMTG_VST3_SDK_VERSION AND SMTG_VST3_SDK_VERSION VERSION_LESS SMTG_VST3_SDK_MINIMUM_VERSION)
+    message(FATAL_ERROR "VST3 SDK ${SMTG_VST3_SDK_VERSION} is not supported, at least ${SMTG_VST3_SDK_MINIMUM_VERSION} is needed.")
+endif()
+
 set(SMTG_ENABLE_VSTGUI_SUPPORT OFF)
 if(SMTG_ENABLE_VSTGUI_SUPPORT_CLI)
     set(SMTG_ENABLE_VSTGUI_SUPPORT ${SMTG_ENABLE_VSTGUI_SUPPORT_CLI})
 endif(SMTG_ENABLE_VSTGUI_SUPPORT_CLI)
 
+# Build the VST3 SDK once into a shared directory and link the generated projects against it.
+set(SMTG_USE_PREBUILT_SDK OFF)
+if(SMTG_USE_PREBUILT_SDK_CLI)
+    set(SMTG_USE_PREBUILT_SDK ${SMTG_USE_PREBUILT_SDK_CLI})
+endif(SMTG_USE_PREBUILT_SDK_CLI)
+
+if(CMAKE_HOST_WIN32)
+    file(TO_CMAKE_PATH "$ENV{LOCALAPPDATA}/Steinberg/VST3SDKPrebuilt" SMTG_PREBUILT_SDK_CACHE_DIR)
+elseif(CMAKE_HOST_APPLE)
+    set(SMTG_PREBUILT_SDK_CACHE_DIR "$ENV{HOME}/Library/Caches/Steinberg/VST3SDKPrebuilt")
+else()
+    set(SMTG_PREBUILT_SDK_CACHE_DIR "$ENV{HOME}/.cache/Steinberg/VST3SDKPrebuilt")
+endif()
+if(SMTG_PREBUILT_SDK_CACHE_DIR_CLI)
+    string(REPLACE "\"" "" SMTG_PREBUILT_SDK_CACHE_DIR ${SMTG_PREBUILT_SDK_CACHE_DIR_CLI})
+endif(SMTG_PREBUILT_SDK_CACHE_DIR_CLI)
+
+# Compiler cache of the generated project: OFF, AUTO (ccache or sccache) or a program name or path.
+set(SMTG_COMPILER_CACHE OFF)
+if(SMTG_COMPILER_CACHE_CLI)
+    string(REPLACE "\"" "" SMTG_COMPILER_CACHE ${SMTG_COMPILER_CACHE_CLI})
+endif(SMTG_COMPILER_CACHE_CLI)
+
+# Precompiled VST3 SDK headers for the plug-in target of the generated project.
+set(SMTG_PRECOMPILED_HEADERS OFF)
+if(SMTG_PRECOMPILED_HEADERS_CLI)
+    set(SMTG_PRECOMPILED_HEADERS ${SMTG_PRECOMPILED_HEADERS_CLI})
+endif(SMTG_PRECOMPILED_HEADERS_CLI)
+
+# Unity build of the plug-in target of the generated project.
+set(SMTG_UNITY_BUILD OFF)
+if(SMTG_UNITY_BUILD_CLI)
+    set(SMTG_UNITY_BUILD ${SMTG_UNITY_BUILD_CLI})
+endif(SMTG_UNITY_BUILD_CLI)
+
+# Compile time traces (clang -ftime-trace) of the generated project.
+set(SMTG_TIME_TRACE OFF)
+if(SMTG_TIME_TRACE_CLI)
+    set(SMTG_TIME_TRACE ${SMTG_TIME_TRACE_CLI})
+endif(SMTG_TIME_TRACE_CLI)
+
+# Link time optimization for the Release configuration of the generated project.
+set(SMTG_RELEASE_IPO ON)
+if(DEFINED SMTG_RELEASE_IPO_CLI)
+    set(SMTG_RELEASE_IPO ${SMTG_RELEASE_IPO_CLI})
+endif()
+
+# Minimum x86-64 instruction set of the plug-in: DEFAULT, x86-64-v2 or x86-64-v3.
+set(SMTG_INSTRUCTION_SET DEFAULT)
+if(SMTG_INSTRUCTION_SET_CLI)
+    string(REPLACE "\"" "" SMTG_INSTRUCTION_SET ${SMTG_INSTRUCTION_SET_CLI})
+endif(SMTG_INSTRUCTION_SET_CLI)
+if(NOT SMTG_INSTRUCTION_SET MATCHES "^(DEFAULT|x86-64-v2|x86-64-v3)$")
+    message(FATAL_ERROR "Unknown instruction set ${SMTG_INSTRUCTION_SET}, use DEFAULT, x86-64-v2 or x86-64-v3.")
+endif()
+
+# Floating point model of the plug-in: PRECISE, STRICT or FAST.
+set(SMTG_FLOAT_MODEL PRECISE)
+if(SMTG_FLOAT_MODEL_CLI)
+    string(REPLACE "\"" "" SMTG_FLOAT_MODEL ${SMTG_FLOAT_MODEL_CLI})
+endif(SMTG_FLOAT_MODEL_CLI)
+if(NOT SMTG_FLOAT_MODEL MATCHES "^(PRECISE|STRICT|FAST)$")
+    message(FATAL_ERROR "Unknown floating point model ${SMTG_FLOAT_MODEL}, use PRECISE, STRICT or FAST.")
+endif()
+
+# Profile guided optimization mode of the generated project: OFF, GENERATE or USE.
+set(SMTG_PGO OFF)
+if(SMTG_PGO_CLI)
+    string(REPLACE "\"" "" SMTG_PGO ${SMTG_PGO_CLI})
+endif(SMTG_PGO_CLI)
+if(NOT SMTG_PGO MATCHES "^(OFF|GENERATE|USE)$")
+    message(FATAL_ERROR "Unknown PGO mode ${SMTG_PGO}, use OFF, GENERATE or USE.")
+endif()
+
+# Per-sample smoothing of the parameters with a smoothing time: OFF, ONE_POLE or LINEAR.
+set(SMTG_PARAMETER_SMOOTHING OFF)
+if(SMTG_PARAMETER_SMOOTHING_CLI)
+    string(REPLACE "\"" "" SMTG_PARAMETER_SMOOTHING ${SMTG_PARAMETER_SMOOTHING_CLI})
+endif(SMTG_PARAMETER_SMOOTHING_CLI)
+if(NOT SMTG_PARAMETER_SMOOTHING MATCHES "^(OFF|ONE_POLE|LINEAR)$")
+    message(FATAL_ERROR "Unknown parameter smoothing ${SMTG_PARAMETER_SMOOTHING}, use OFF, ONE_POLE or LINEAR.")
+endif()
+
+# 64-bit (double) sample processing of the generated processor.
+set(SMTG_PROCESS_64BIT_SAMPLES OFF)
+if(SMTG_PROCESS_64BIT_SAMPLES_CLI)
+    set(SMTG_PROCESS_64BIT_SAMPLES ${SMTG_PROCESS_64BIT_SAMPLES_CLI})
+endif(SMTG_PROCESS_64BIT_SAMPLES_CLI)
+
+# SIMD kernels with runtime dispatch (SSE2, AVX2, NEON or scalar) for the generated processor.
+set(SMTG_SIMD_KERNELS OFF)
+if(SMTG_SIMD_KERNELS_CLI)
+    set(SMTG_SIMD_KERNELS ${SMTG_SIMD_KERNELS_CLI})
+endif(SMTG_SIMD_KERNELS_CLI)
+
+# DC offset added by protectFeedback of the generated project against denormals in feedback paths.
+set(SMTG_DENORMAL_DC_OFFSET OFF)
+if(SMTG_DENORMAL_DC_OFFSET_CLI)
+    set(SMTG_DENORMAL_DC_OFFSET ${SMTG_DENORMAL_DC_OFFSET_CLI})
+endif(SMTG_DENORMAL_DC_OFFSET_CLI)
+
+# Realtime checks of Debug builds of the generated project (Linux only).
+set(SMTG_REALTIME_CHECKS OFF)
+if(SMTG_REALTIME_CHECKS_CLI)
+    set(SMTG_REALTIME_CHECKS ${SMTG_REALTIME_CHECKS_CLI})
+endif(SMTG_REALTIME_CHECKS_CLI)
+
+# The offline processing benchmark target of the generated project.
+set(SMTG_BENCHMARK ON)
+if(DEFINED SMTG_BENCHMARK_CLI)
+    set(SMTG_BENCHMARK ${SMTG_BENCHMARK_CLI})
+endif(DEFINED SMTG_BENCHMARK_CLI)
+
+# Template files which are not generated with the chosen options.
+set(SMTG_EXCLUDED_TEMPLATE_FILES "")
+if(SMTG_PARAMETER_SMOOTHING STREQUAL "OFF")
+    list(APPEND SMTG_EXCLUDED_TEMPLATE_FILES vst3plugin_folder/source/vst3pluginsmoothers.h.in)
+endif()
+if(NOT SMTG_SIMD_KERNELS)
+    list(APPEND SMTG_EXCLUDED_TEMPLATE_FILES
+        vst3plugin_folder/source/vst3pluginsimd.h.in
+        vst3plugin_folder/source/vst3pluginsimdkernels.h.in
+    )
+endif()
+
 function(smtg_print_generator_specifics)
+    message(STATUS "SMTG_BENCHMARK                  : ${SMTG_BENCHMARK}")
+    message(STATUS "SMTG_COMPILER_CACHE             : ${SMTG_COMPILER_CACHE}")
+    message(STATUS "SMTG_DENORMAL_DC_OFFSET         : ${SMTG_DENORMAL_DC_OFFSET}")
     message(STATUS "SMTG_ENABLE_VSTGUI_SUPPORT      : ${SMTG_ENABLE_VSTGUI_SUPPORT}")
+    message(STATUS "SMTG_FLOAT_MODEL                : ${SMTG_FLOAT_MODEL}")
     message(STATUS "SMTG_GENERATOR_OUTPUT_DIRECTORY : ${SMTG_GENERATOR_OUTPUT_DIRECTORY}")
+    message(STATUS "SMTG_INSTRUCTION_SET            : ${SMTG_INSTRUCTION_SET}")
+    message(STATUS "SMTG_PARAMETER_SMOOTHING        : ${SMTG_PARAMETER_SMOOTHING}")
+    message(STATUS "SMTG_PGO                        : ${SMTG_PGO}")
+    message(STATUS "SMTG_PROCESS_64BIT_SAMPLES      : ${SMTG_PROCESS_64BIT_SAMPLES}")
+    message(STATUS "SMTG_PREBUILT_SDK_CACHE_DIR     : ${SMTG_PREBUILT_SDK_CACHE_DIR}")
+    message(STATUS "SMTG_PRECOMPILED_HEADERS        : ${SMTG_PRECOMPILED_HEADERS}")
+    message(STATUS "SMTG_REALTIME_CHECKS            : ${SMTG_REALTIME_CHECKS}")
+    message(STATUS "SMTG_RELEASE_IPO                : ${SMTG_RELEASE_IPO}")
+    message(STATUS "SMTG_SIMD_KERNELS               : ${SMTG_SIMD_KERNELS}")
     message(STATUS "SMTG_TEMPLATE_FILES_PATH        : ${SMTG_TEMPLATE_FILES_PATH}")
+    message(STATUS "SMTG_TIME_TRACE                 : ${SMTG_TIME_TRACE}")
+    message(STATUS "SMTG_UNITY_BUILD                : ${SMTG_UNITY_BUILD}")
+    message(STATUS "SMTG_USE_PREBUILT_SDK           : ${SMTG_USE_PREBUILT_SDK}")
     message(STATUS "SMTG_VST3_SDK_SOURCE_DIR        : ${SMTG_VST3_SDK_SOURCE_DIR}")
+    message(STATUS "SMTG_VST3_SDK_VERSION           : ${SMTG_VST3_SDK_VERSION}")
     message("")
 endfunction(smtg_print_generator_specifics)
@@ -0,0 +1,116 @@
+cmake_minimum_required(VERSION 3.14.0)
+
+# The parameters of the plug-in, besides the bypass parameter which is always added.
+# One entry per parameter: ID|Title|Units|Min|Max|Default|SmoothingMs[|StepCount]
+# The ID is used for the C++ identifiers (k<ID>Id), the range and the default are plain values.
+set(SMTG_PLUGIN_PARAMETERS "Gain|Gain|dB|-60|6|0|20")
+if(SMTG_PLUGIN_PARAMETERS_CLI)
+    set(SMTG_PLUGIN_PARAMETERS "${SMTG_PLUGIN_PARAMETERS_CLI}")
+endif(SMTG_PLUGIN_PARAMETERS_CLI)
+
+string(TOUPPER "${SMTG_PLUGIN_CLASS_NAME}" SMTG_PLUGIN_CLASS_NAME_UPPER)
+
+# Returns the number as C++ floating point literal.
+function(smtg_make_double_literal id number out_var)
+    if(NOT number MATCHES "^-?[0-9]+(\\.[0-9]*)?([eE][-+]?[0-9]+)?$")
+        message(FATAL_ERROR "Parameter ${id}: ${number} is not a number.")
+    endif()
+    if(NOT number MATCHES "[.eE]")
+        string(APPEND number ".")
+    endif()
+    set(${out_var} "${number}" PARENT_SCOPE)
+endfunction(smtg_make_double_literal)
+
+# Sets SMTG_PARAMETER_LIST_CODE_SNIPPET (the lines of the parameter list macro) and
+# SMTG_PARAMETER_CHANGE_CODE_SNIPPET (the cases of the processor's applyParamChange).
+# With SMTG_PARAMETER_SMOOTHING the example gain is smoothed if it has a smoothing time.
+function(smtg_generate_plugin_parameters)
+    set(list_snippet "PARAM (Bypass, \"Bypass\", \"\", 0., 1., 0., 1, ParamFlags::kCanAutomate | ParamFlags::kIsBypass, 0.)")
+    set(change_snippet "")
+    set(process_gain_snippet "")
+    set(process_gain_loop_snippet "")
+    set(ids Bypass)
+    foreach(entry ${SMTG_PLUGIN_PARAMETERS})
+        string(REPLACE "|" ";" fields "${entry}")
+        list(LENGTH fields num_fields)
+        if(num_fields LESS 7 OR num_fields GREATER 8)
+            message(FATAL_ERROR "Parameter \"${entry}\" needs the fields ID|Title|Units|Min|Max|Default|SmoothingMs[|StepCount].")
+        endif()
+        list(GET fields 0 id)
+        list(GET fields 1 title)
+        list(GET fields 2 units)
+        list(GET fields 3 min)
+        list(GET fields 4 max)
+        list(GET fields 5 default)
+        list(GET fields 6 smoothing)
+        set(step_count 0)
+        if(num_fields EQUAL 8)
+            list(GET fields 7 step_count)
+        endif()
+
+        if(NOT id MATCHES "^[A-Za-z][A-Za-z0-9_]*$")
+            message(FATAL_ERROR "Parameter ID ${id} is not a valid C++ identifier.")
+        endif()
+        list(FIND ids ${id} index)
+        if(index GREATER -1)
+            message(FATAL_ERROR "Parameter ID ${id} is used twice.")
+        endif()
+        list(APPEND ids ${id})
+        smtg_make_double_literal(${id} "${min}" min_literal)
+        smtg_make_double_literal(${id} "${max}" max_literal)
+        smtg_make_double_literal(${id} "${default}" default_literal)
+        smtg_make_double_literal(${id} "${smoothing}" smoothing_literal)
+        if(NOT min LESS max)
+            message(FATAL_ERROR "Parameter ${id}: the minimum ${min} has to be less than the maximum ${max}.")
+        endif()
+        if(default LESS min OR default GREATER max)
+            message(FATAL_ERROR "Parameter ${id}: the default ${default} is not in the range ${min} to ${max}.")
+        endif()
+        if(NOT step_count MATCHES "^[0-9]+$")
+            message(FATAL_ERROR "Parameter ${id}: the step count ${step_count} is not a number.")
+        endif()
+        # title and units become C string literals
+        string(REPLACE "\\" "" title "${title}")
+        string(REPLACE "\\" "" units "${units}")
+        string(REPLACE "\"" "\\\"" title "${title}")
+        string(REPLACE "\"" "\\\"" units "${units}")
+
+        string(APPEND list_snippet " \\\n\tPARAM (${id}, \"${title}\", \"${units}\", ${min_literal}, ${max_literal}, ${default_literal}, ${step_count}, ParamFlags::kCanAutomate, ${smoothing_literal})")
+
+        # the example processing applies a parameter named Gain
+        if(id STREQUAL "Gain")
+            if(units STREQUAL "dB")
+                set(gain_code "static_cast<float> (std::pow (10., toPlain (ParamTable[kGainId], value) / 20.))")
+            else()
+                set(gain_code "static_cast<float> (toPlain (ParamTable[kGainId], value))")
+            endif()
+            set(smoothing_code "")
+            if(NOT SMTG_PARAMETER_SMOOTHING STREQUAL "OFF" AND smoothing_literal GREATER 0)
+                # gain is the target, the smoother ramps to it
+                set(smoothing_code "\n\t\t\tsmoothers.setTarget (kGainId, gain);")
+                set(process_gain_snippet "\n\tconst float* gains = bypass ? nullptr : smoothers.getValues (kGainId);")
+                if(SMTG_SIMD_KERNELS)
+                    set(gains_code "kernels.gains (in, gains, out, numSamples);")
+                else()
+                    set(gains_code "for (int32 sample = 0; sample < numSamples; ++sample)\n\t\t\t\tout[sample] = in[sample] * gains[sample];")
+                endif()
+                set(process_gain_loop_snippet "\n\t\tif (gains)\n\t\t{\n\t\t\t${gains_code}\n\t\t\tcontinue;\n\t\t}")
+            endif()
+            string(APPEND change_snippet "\n\t\tcase kGainId:\n\t\t\tgain = ${gain_code};${smoothing_code}\n\t\t\tbreak;")
+        else()
+            # to fill in
+            string(APPEND change_snippet "\n\t\tcase k${id}Id:\n\t\t\tbreak;")
+        endif()
+    endforeach()
+
+    set(SMTG_PARAMETER_LIST_CODE_SNIPPET "${list_snippet}" PARENT_SCOPE)
+    set(SMTG_PARAMETER_CHANGE_CODE_SNIPPET "${change_snippet}" PARENT_SCOPE)
+    set(SMTG_PROCESS_SMOOTHED_GAIN_CODE_SNIPPET "${process_gain_snippet}" PARENT_SCOPE)
+    set(SMTG_PROCESS_SMOOTHED_GAIN_LOOP_CODE_SNIPPET "${process_gain_loop_snippet}" PARENT_SCOPE)
+    set(SMTG_PLUGIN_PARAMETER_IDS "${ids}" PARENT_SCOPE)
+endfunction(smtg_generate_plugin_parameters)
+
+function(smtg_print_plugin_parameters)
+    message(STATUS "SMTG_PLUGIN_PARAMETERS      : ${SMTG_PLUGIN_PARAMETER_IDS}")
+    message("")
+endfunction(smtg_print_plugin_parameters)
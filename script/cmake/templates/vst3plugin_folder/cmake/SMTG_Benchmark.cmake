@@ -0,0 +1,32 @@
+cmake_minimum_required(VERSION 3.14.0)
+
+# The offline processing benchmark of the plug-in: an executable which runs the processor
+# without a host and reports its DSP cost. The target <benchmark>_sweep runs it over the block
+# sizes 1 to 8192 and 1 and 2 channels and writes the report to <benchmark>_sweep.csv in the build
+# folder.
+
+# Adds the executable benchmark_target built from the sources, which contain the benchmark's main
+# function, and the objects of processor_target, the object library with the processor of the
+# plug-in. The parameter changes of the VST3 SDK's hosting code are compiled in, the other SDK
+# code is linked from the sdk library like for the plug-in. The benchmark is not part of the
+# default build, it is built with its target or as dependency of the sweep and the PGO training.
+function(smtg_add_processor_benchmark benchmark_target processor_target)
+    add_executable(${benchmark_target} EXCLUDE_FROM_ALL
+        ${ARGN}
+        ${vst3sdk_SOURCE_DIR}/public.sdk/source/vst/hosting/parameterchanges.h
+        ${vst3sdk_SOURCE_DIR}/public.sdk/source/vst/hosting/parameterchanges.cpp
+    )
+    target_link_libraries(${benchmark_target}
+        PRIVATE
+            ${processor_target}
+            ${vst3sdk_target_prefix}sdk
+    )
+
+    add_custom_target(${benchmark_target}_sweep
+        COMMAND ${benchmark_target} --sweep --format csv
+            --output "${PROJECT_BINARY_DIR}/${benchmark_target}_sweep.csv"
+        DEPENDS ${benchmark_target}
+        COMMENT "Running ${benchmark_target} over the block sizes and channel counts"
+        VERBATIM
+    )
+endfunction(smtg_add_processor_benchmark)
@@ -0,0 +1,93 @@
+cmake_minimum_required(VERSION 3.14.0)
+
+# Reduces the compile time of the generated project with precompiled headers and unity builds.
+# Both need cmake 3.16 or newer, with older versions the project is built as before.
+
+set(SMTG_PRECOMPILED_SDK_HEADERS
+    <pluginterfaces/base/funknown.h>
+    <pluginterfaces/vst/ivstparameterchanges.h>
+    <base/source/fstreamer.h>
+    <public.sdk/source/vst/vstaudioeffect.h>
+    <public.sdk/source/vst/vsteditcontroller.h>
+    <public.sdk/source/main/pluginfactory.h>
+)
+
+set(SMTG_UNITY_BUILD_SDK_LIBRARIES
+    base
+    pluginterfaces
+    sdk_common
+    sdk
+    vstgui
+    vstgui_uidescription
+    vstgui_support
+)
+
+function(smtg_check_compile_time_support out_var feature)
+    if(CMAKE_VERSION VERSION_LESS 3.16)
+        message(STATUS "${feature} need cmake 3.16 or newer and are not used.")
+        set(${out_var} FALSE PARENT_SCOPE)
+    else()
+        set(${out_var} TRUE PARENT_SCOPE)
+    endif()
+endfunction(smtg_check_compile_time_support)
+
+# Precompiles the VST3 SDK headers included by the sources of the target. With NO_EDITOR the
+# VSTGUI editor header is left out, for targets without the editor like the processor.
+function(smtg_target_precompile_sdk_headers target)
+    cmake_parse_arguments(PARSE_ARGV 1 pch "NO_EDITOR" "" "")
+    smtg_check_compile_time_support(supported "Precompiled headers")
+    if(NOT supported)
+        return()
+    endif()
+    set(headers ${SMTG_PRECOMPILED_SDK_HEADERS})
+    if(SMTG_ADD_VSTGUI AND NOT pch_NO_EDITOR)
+        list(APPEND headers <vstgui/plugin-bindings/vst3editor.h>)
+    endif()
+    target_precompile_headers(${target} PRIVATE ${headers})
+endfunction(smtg_target_precompile_sdk_headers)
+
+# Compiles the sources of the targets as unity build.
+function(smtg_target_enable_unity_build)
+    smtg_check_compile_time_support(supported "Unity builds")
+    if(NOT supported)
+        return()
+    endif()
+    foreach(target ${ARGN})
+        set_target_properties(${target} PROPERTIES UNITY_BUILD ON)
+    endforeach()
+endfunction(smtg_target_enable_unity_build)
+
+# Compiles the libraries of the VST3 SDK added to this project as unity build.
+# The libraries of a shared prebuilt SDK are not affected.
+function(smtg_enable_sdk_unity_build)
+    set(targets "")
+    foreach(library ${SMTG_UNITY_BUILD_SDK_LIBRARIES})
+        if(TARGET ${library})
+            get_target_property(imported ${library} IMPORTED)
+            if(NOT imported)
+                list(APPEND targets ${library})
+            endif()
+        endif()
+    endforeach()
+    smtg_target_enable_unity_build(${targets})
+endfunction(smtg_enable_sdk_unity_build)
+
+# Lets clang write a compile time trace (-ftime-trace) next to the object file of each source of
+# the targets added after the call, call it before adding the VST3 SDK to trace the SDK as well.
+# Headers which are precompiled do not show up in the traces.
+function(smtg_enable_time_trace)
+    if(NOT CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        message(WARNING "Compile time traces need clang, ${CMAKE_CXX_COMPILER_ID} does not support -ftime-trace.")
+        return()
+    endif()
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang" AND CMAKE_CXX_COMPILER_VERSION VERSION_LESS 9)
+        message(WARNING "Compile time traces need clang 9 or newer.")
+        return()
+    endif()
+    if(MSVC)
+        # clang-cl
+        add_compile_options(/clang:-ftime-trace)
+    else()
+        add_compile_options(-ftime-trace)
+    endif()
+endfunction(smtg_enable_time_trace)
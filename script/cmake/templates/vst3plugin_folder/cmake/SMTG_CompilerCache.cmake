@@ -0,0 +1,69 @@
+cmake_minimum_required(VERSION 3.14.0)
+
+# Runs the compiler through a compiler cache (ccache or sccache) to speed up clean rebuilds.
+#
+# SMTG_PLUGIN_COMPILER_CACHE selects the cache:
+#   OFF     : no compiler cache
+#   AUTO    : ccache or sccache, whichever is found first
+#   <name>  : the given program (e.g. ccache, sccache or a full path)
+#
+# The found program is stored in SMTG_PLUGIN_COMPILER_CACHE_PROGRAM.
+
+# Call before adding the SDK, the launcher is applied to all targets created afterwards.
+function(smtg_enable_compiler_cache cache)
+    # Search again when the selected cache changed.
+    if(NOT "${cache}" STREQUAL "${SMTG_PLUGIN_COMPILER_CACHE_SELECTED}")
+        unset(SMTG_PLUGIN_COMPILER_CACHE_PROGRAM CACHE)
+        set(SMTG_PLUGIN_COMPILER_CACHE_SELECTED "${cache}" CACHE INTERNAL "")
+    endif()
+
+    if(NOT cache OR cache STREQUAL "OFF")
+        unset(SMTG_PLUGIN_COMPILER_CACHE_PROGRAM CACHE)
+        return()
+    endif()
+
+    # Only the Makefile and Ninja generators support compiler launchers.
+    if(NOT CMAKE_GENERATOR MATCHES "Ninja|Makefiles")
+        message(STATUS "Compiler cache: not supported by the ${CMAKE_GENERATOR} generator")
+        unset(SMTG_PLUGIN_COMPILER_CACHE_PROGRAM CACHE)
+        return()
+    endif()
+
+    # Keep a launcher configured by the user.
+    if(CMAKE_CXX_COMPILER_LAUNCHER)
+        message(STATUS "Compiler cache: using the configured launcher ${CMAKE_CXX_COMPILER_LAUNCHER}")
+        return()
+    endif()
+
+    if(cache STREQUAL "AUTO")
+        set(names ccache sccache)
+    else()
+        set(names ${cache})
+    endif()
+    find_program(SMTG_PLUGIN_COMPILER_CACHE_PROGRAM NAMES ${names}
+        DOC "Compiler cache used as compiler launcher"
+    )
+    if(NOT SMTG_PLUGIN_COMPILER_CACHE_PROGRAM)
+        message(STATUS "Compiler cache: ${names} not found")
+        return()
+    endif()
+
+    set(launcher "${SMTG_PLUGIN_COMPILER_CACHE_PROGRAM}")
+    # ccache only caches compilations using precompiled headers with these sloppiness settings.
+    get_filename_component(program_name "${SMTG_PLUGIN_COMPILER_CACHE_PROGRAM}" NAME_WE)
+    if(SMTG_PLUGIN_PRECOMPILED_HEADERS AND program_name STREQUAL "ccache")
+        set(launcher ${CMAKE_COMMAND} -E env
+            "CCACHE_SLOPPINESS=pch_defines,time_macros,include_file_mtime,include_file_ctime"
+            "${SMTG_PLUGIN_COMPILER_CACHE_PROGRAM}"
+        )
+    endif()
+
+    set(languages C CXX)
+    if(APPLE)
+        list(APPEND languages OBJC OBJCXX)
+    endif()
+    foreach(language ${languages})
+        set(CMAKE_${language}_COMPILER_LAUNCHER "${launcher}" PARENT_SCOPE)
+    endforeach()
+    message(STATUS "Compiler cache: ${SMTG_PLUGIN_COMPILER_CACHE_PROGRAM}")
+endfunction(smtg_enable_compiler_cache)
@@ -0,0 +1,44 @@
+cmake_minimum_required(VERSION 3.14.0)
+
+# Runs the PGO training, called by the target <plug-in>_pgo_training with:
+#   SMTG_PGO_PROFILE_DIR     : the folder of the profiles
+#   SMTG_PGO_COMPILER_ID     : CMAKE_CXX_COMPILER_ID of the project
+#   SMTG_PGO_PROFDATA        : the llvm-profdata command for Clang
+#   SMTG_PGO_TRAINING_COMMAND: the command running the instrumented plug-in
+
+# Profiles of older builds do not match the instrumented code anymore.
+file(GLOB old_profiles
+    "${SMTG_PGO_PROFILE_DIR}/*.profraw"
+    "${SMTG_PGO_PROFILE_DIR}/*.profdata"
+    "${SMTG_PGO_PROFILE_DIR}/*.pgc"
+)
+file(GLOB_RECURSE old_gcc_profiles "${SMTG_PGO_PROFILE_DIR}/*.gcda")
+if(old_profiles OR old_gcc_profiles)
+    file(REMOVE ${old_profiles} ${old_gcc_profiles})
+endif()
+
+set(ENV{LLVM_PROFILE_FILE} "${SMTG_PGO_PROFILE_DIR}/default_%p.profraw")
+set(ENV{VCPROFILE_PATH} "${SMTG_PGO_PROFILE_DIR}")
+execute_process(
+    COMMAND ${SMTG_PGO_TRAINING_COMMAND}
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "The PGO training failed: ${result}")
+endif()
+
+if(SMTG_PGO_COMPILER_ID MATCHES "Clang" AND SMTG_PGO_PROFDATA)
+    file(GLOB raw_profiles "${SMTG_PGO_PROFILE_DIR}/*.profraw")
+    if(NOT raw_profiles)
+        message(FATAL_ERROR "The PGO training did not write any profiles.")
+    endif()
+    execute_process(
+        COMMAND ${SMTG_PGO_PROFDATA} merge -output=${SMTG_PGO_PROFILE_DIR}/default.profdata ${raw_profiles}
+        RESULT_VARIABLE result
+    )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Merging the PGO profiles failed: ${result}")
+    endif()
+endif()
+
+message(STATUS "PGO profiles written to ${SMTG_PGO_PROFILE_DIR}, reconfigure with SMTG_PLUGIN_PGO=USE and build the Release configuration.")
@@ -0,0 +1,269 @@
+cmake_minimum_required(VERSION 3.14.0)
+
+# Builds the libraries of the VST3 SDK once per SDK version and sources, compiler, platform and
+# configuration into a shared directory and provides them as imported targets named vst3sdk_prebuilt::<target>.
+#
+# The SDK is still added with add_subdirectory (EXCLUDE_FROM_ALL) to get its cmake functions and
+# the usage requirements of its targets, but its libraries are only compiled in the shared build.
+
+set(SMTG_PREBUILT_SDK_LIBRARIES
+    base
+    pluginterfaces
+    sdk_common
+    sdk
+    vstgui
+    vstgui_uidescription
+    vstgui_support
+)
+
+# Call before adding the SDK.
+macro(smtg_prebuilt_vst3_sdk_prepare)
+    # The validator would build the SDK libraries in this project again.
+    set(SMTG_RUN_VST_VALIDATOR OFF CACHE BOOL "" FORCE)
+    set(SMTG_ADD_VST3_PLUGINS_SAMPLES OFF CACHE BOOL "" FORCE)
+    set(SMTG_ADD_VST3_HOSTING_SAMPLES OFF CACHE BOOL "" FORCE)
+endmacro(smtg_prebuilt_vst3_sdk_prepare)
+
+# Returns the directory of the shared build matching this project's toolchain.
+function(smtg_prebuilt_vst3_sdk_directory sdk_dir cache_dir out_var)
+    file(STRINGS "${sdk_dir}/pluginterfaces/vst/vsttypes.h" version_lines
+        REGEX "#define kVstVersion(Major|Minor|Sub)[ \t]+[0-9]+"
+    )
+    set(version "")
+    foreach(line ${version_lines})
+        string(REGEX MATCH "[0-9]+$" number "${line}")
+        list(APPEND version ${number})
+    endforeach()
+    string(REPLACE ";" "." version "${version}")
+    if(NOT version)
+        set(version "unknown")
+    endif()
+
+    # Local changes of the SDK sources need a new build, the modification times of the sources
+    # and build scripts of the libraries are part of the key.
+    file(GLOB_RECURSE sdk_files LIST_DIRECTORIES false
+        "${sdk_dir}/base/*.h" "${sdk_dir}/base/*.cpp" "${sdk_dir}/base/*.mm"
+        "${sdk_dir}/pluginterfaces/*.h" "${sdk_dir}/pluginterfaces/*.cpp"
+        "${sdk_dir}/public.sdk/source/*.h" "${sdk_dir}/public.sdk/source/*.cpp" "${sdk_dir}/public.sdk/source/*.mm"
+        "${sdk_dir}/vstgui4/vstgui/*.h" "${sdk_dir}/vstgui4/vstgui/*.cpp" "${sdk_dir}/vstgui4/vstgui/*.mm"
+        "${sdk_dir}/cmake/*.cmake" "${sdk_dir}/*CMakeLists.txt"
+    )
+    list(SORT sdk_files)
+    set(sdk_fingerprint "")
+    foreach(sdk_file ${sdk_files})
+        file(TIMESTAMP "${sdk_file}" timestamp "%s")
+        string(APPEND sdk_fingerprint "${sdk_file}${timestamp}")
+    endforeach()
+    string(SHA1 sdk_fingerprint "${sdk_fingerprint}")
+
+    # Everything which changes the produced object code has to be part of the key.
+    string(SHA1 key
+        "${sdk_dir}|${sdk_fingerprint}|${CMAKE_GENERATOR}|${CMAKE_GENERATOR_PLATFORM}|${CMAKE_GENERATOR_TOOLSET}|${CMAKE_C_COMPILER}|${CMAKE_CXX_COMPILER}|${CMAKE_CXX_COMPILER_VERSION}|${CMAKE_OSX_ARCHITECTURES}|${CMAKE_OSX_DEPLOYMENT_TARGET}|${SMTG_ADD_VSTGUI}|${CMAKE_INTERPROCEDURAL_OPTIMIZATION_RELEASE}"
+    )
+    string(SUBSTRING ${key} 0 12 key)
+    set(${out_var} "${cache_dir}/${version}-${CMAKE_CXX_COMPILER_ID}-${CMAKE_CXX_COMPILER_VERSION}-${key}" PARENT_SCOPE)
+endfunction(smtg_prebuilt_vst3_sdk_directory)
+
+# Configures and builds the shared SDK build for one configuration if it does not exist yet.
+# The file <dir>/prebuilt-<config>.cmake is written when the build succeeded.
+# Builds the libraries listed in the variable targets of the caller.
+function(smtg_prebuilt_vst3_sdk_build sdk_dir prebuilt_dir config out_var)
+    set(locations_file "${prebuilt_dir}/prebuilt-${config}.cmake")
+    set(${out_var} "${locations_file}" PARENT_SCOPE)
+    if(EXISTS "${locations_file}")
+        return()
+    endif()
+
+    file(MAKE_DIRECTORY "${prebuilt_dir}")
+    # Other projects may be configured at the same time.
+    file(LOCK "${prebuilt_dir}/prebuilt.lock" GUARD FUNCTION TIMEOUT 3600)
+    if(EXISTS "${locations_file}")
+        return()
+    endif()
+
+    message(STATUS "Building the shared VST3 SDK (${config}) in ${prebuilt_dir}")
+    if(CMAKE_CONFIGURATION_TYPES)
+        set(build_dir "${prebuilt_dir}/build")
+    else()
+        set(build_dir "${prebuilt_dir}/build-${config}")
+    endif()
+    if(NOT EXISTS "${build_dir}/CMakeCache.txt")
+        set(configure_args
+            -S "${sdk_dir}"
+            -B "${build_dir}"
+            -G "${CMAKE_GENERATOR}"
+            "-DCMAKE_C_COMPILER=${CMAKE_C_COMPILER}"
+            "-DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER}"
+            "-DSMTG_ADD_VSTGUI=${SMTG_ADD_VSTGUI}"
+            -DSMTG_ADD_VST3_PLUGINS_SAMPLES=OFF
+            -DSMTG_ADD_VST3_HOSTING_SAMPLES=OFF
+            -DSMTG_RUN_VST_VALIDATOR=OFF
+        )
+        # the compiler cache of the project, it does not change the object code
+        foreach(lang C CXX)
+            if(CMAKE_${lang}_COMPILER_LAUNCHER)
+                list(APPEND configure_args "-DCMAKE_${lang}_COMPILER_LAUNCHER=${CMAKE_${lang}_COMPILER_LAUNCHER}")
+            endif()
+        endforeach()
+        # link time optimization of the Release configuration
+        if(CMAKE_INTERPROCEDURAL_OPTIMIZATION_RELEASE)
+            list(APPEND configure_args -DCMAKE_INTERPROCEDURAL_OPTIMIZATION_RELEASE=ON)
+        endif()
+        if(CMAKE_GENERATOR_PLATFORM)
+            list(APPEND configure_args -A "${CMAKE_GENERATOR_PLATFORM}")
+        endif()
+        if(CMAKE_GENERATOR_TOOLSET)
+            list(APPEND configure_args -T "${CMAKE_GENERATOR_TOOLSET}")
+        endif()
+        if(CMAKE_OSX_ARCHITECTURES)
+            list(APPEND configure_args "-DCMAKE_OSX_ARCHITECTURES=${CMAKE_OSX_ARCHITECTURES}")
+        endif()
+        if(CMAKE_OSX_DEPLOYMENT_TARGET)
+            list(APPEND configure_args "-DCMAKE_OSX_DEPLOYMENT_TARGET=${CMAKE_OSX_DEPLOYMENT_TARGET}")
+        endif()
+        if(NOT CMAKE_CONFIGURATION_TYPES)
+            list(APPEND configure_args "-DCMAKE_BUILD_TYPE=${config}")
+        endif()
+        execute_process(
+            COMMAND ${CMAKE_COMMAND} ${configure_args}
+            RESULT_VARIABLE result
+        )
+        if(NOT result EQUAL 0)
+            file(REMOVE_RECURSE "${build_dir}")
+            message(WARNING "Configuring the shared VST3 SDK failed, the SDK is built with the project.")
+            set(${out_var} "" PARENT_SCOPE)
+            return()
+        endif()
+    endif()
+
+    # cmake before 3.15 only accepts one target per build call
+    foreach(library ${targets})
+        execute_process(
+            COMMAND ${CMAKE_COMMAND} --build "${build_dir}" --config ${config} --parallel --target ${library}
+            RESULT_VARIABLE result
+        )
+        if(NOT result EQUAL 0)
+            message(WARNING "Building the shared VST3 SDK failed, the SDK is built with the project.")
+            set(${out_var} "" PARENT_SCOPE)
+            return()
+        endif()
+    endforeach()
+
+    # Find the built libraries, multi config generators put them into a folder per configuration.
+    set(locations "")
+    foreach(library ${targets})
+        set(file_name "${CMAKE_STATIC_LIBRARY_PREFIX}${library}${CMAKE_STATIC_LIBRARY_SUFFIX}")
+        file(GLOB_RECURSE candidates LIST_DIRECTORIES false "${build_dir}/${file_name}")
+        set(found "")
+        foreach(candidate ${candidates})
+            if(NOT CMAKE_CONFIGURATION_TYPES OR candidate MATCHES "/${config}/")
+                set(found "${candidate}")
+                break()
+            endif()
+        endforeach()
+        if(NOT found)
+            message(WARNING "${file_name} not found in the shared VST3 SDK build, the SDK is built with the project.")
+            set(${out_var} "" PARENT_SCOPE)
+            return()
+        endif()
+        string(APPEND locations "set(SMTG_PREBUILT_${library} \"${found}\")\n")
+    endforeach()
+    file(WRITE "${locations_file}" "${locations}")
+endfunction(smtg_prebuilt_vst3_sdk_build)
+
+# Call after adding the SDK. Sets <prefix_var> to the prefix of the targets to link against:
+# "vst3sdk_prebuilt::" if the shared build is usable, otherwise an empty string.
+function(smtg_add_prebuilt_vst3_sdk sdk_dir cache_dir prefix_var)
+    set(${prefix_var} "" PARENT_SCOPE)
+    smtg_prebuilt_vst3_sdk_directory("${sdk_dir}" "${cache_dir}" prebuilt_dir)
+
+    if(CMAKE_CONFIGURATION_TYPES)
+        set(configs Debug Release)
+    elseif(CMAKE_BUILD_TYPE)
+        set(configs ${CMAKE_BUILD_TYPE})
+    else()
+        set(configs Debug)
+    endif()
+
+    set(targets "")
+    foreach(library ${SMTG_PREBUILT_SDK_LIBRARIES})
+        if(TARGET ${library})
+            get_target_property(type ${library} TYPE)
+            if(type STREQUAL "STATIC_LIBRARY")
+                list(APPEND targets ${library})
+            endif()
+        endif()
+    endforeach()
+    if(NOT targets)
+        return()
+    endif()
+
+    foreach(config ${configs})
+        smtg_prebuilt_vst3_sdk_build("${sdk_dir}" "${prebuilt_dir}" ${config} locations_file)
+        if(NOT locations_file)
+            return()
+        endif()
+        string(TOUPPER ${config} config_upper)
+        include("${locations_file}")
+        foreach(library ${targets})
+            if(NOT EXISTS "${SMTG_PREBUILT_${library}}")
+                message(WARNING "The shared VST3 SDK build in ${prebuilt_dir} is incomplete, delete it to build it again.")
+                return()
+            endif()
+            set(location_${library}_${config_upper} "${SMTG_PREBUILT_${library}}")
+        endforeach()
+    endforeach()
+
+    # Mirror the SDK targets, their usage requirements stay the same.
+    foreach(library ${targets})
+        add_library(vst3sdk_prebuilt::${library} STATIC IMPORTED GLOBAL)
+        foreach(config ${configs})
+            string(TOUPPER ${config} config_upper)
+            set_property(TARGET vst3sdk_prebuilt::${library} APPEND PROPERTY IMPORTED_CONFIGURATIONS ${config_upper})
+            set_target_properties(vst3sdk_prebuilt::${library} PROPERTIES
+                IMPORTED_LOCATION_${config_upper} "${location_${library}_${config_upper}}"
+            )
+        endforeach()
+        if(NOT CMAKE_CONFIGURATION_TYPES)
+            set_target_properties(vst3sdk_prebuilt::${library} PROPERTIES
+                IMPORTED_LOCATION "${location_${library}_${config_upper}}"
+            )
+        else()
+            set_target_properties(vst3sdk_prebuilt::${library} PROPERTIES
+                MAP_IMPORTED_CONFIG_RELWITHDEBINFO Release
+                MAP_IMPORTED_CONFIG_MINSIZEREL Release
+            )
+        endif()
+
+        foreach(property INTERFACE_INCLUDE_DIRECTORIES INTERFACE_COMPILE_DEFINITIONS INTERFACE_COMPILE_OPTIONS INTERFACE_LINK_OPTIONS)
+            get_target_property(value ${library} ${property})
+            if(value)
+                set_target_properties(vst3sdk_prebuilt::${library} PROPERTIES ${property} "${value}")
+            endif()
+        endforeach()
+
+        get_target_property(link_libraries ${library} INTERFACE_LINK_LIBRARIES)
+        if(link_libraries)
+            set(mirrored_link_libraries "")
+            foreach(link_library ${link_libraries})
+                if(link_library MATCHES "^\\$<LINK_ONLY:(.+)>$")
+                    set(name ${CMAKE_MATCH_1})
+                else()
+                    set(name ${link_library})
+                endif()
+                list(FIND targets "${name}" index)
+                if(index GREATER -1)
+                    list(APPEND mirrored_link_libraries vst3sdk_prebuilt::${name})
+                else()
+                    list(APPEND mirrored_link_libraries ${link_library})
+                endif()
+            endforeach()
+            set_target_properties(vst3sdk_prebuilt::${library} PROPERTIES
+                INTERFACE_LINK_LIBRARIES "${mirrored_link_libraries}"
+            )
+        endif()
+    endforeach()
+
+    message(STATUS "Using the shared VST3 SDK build in ${prebuilt_dir}")
+    set(${prefix_var} "vst3sdk_prebuilt::" PARENT_SCOPE)
+endfunction(smtg_add_prebuilt_vst3_sdk)
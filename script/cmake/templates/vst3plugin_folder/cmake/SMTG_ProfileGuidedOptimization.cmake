@@ -0,0 +1,164 @@
+cmake_minimum_required(VERSION 3.14.0)
+
+# Profile guided optimization (PGO) of the plug-in target, supported with GCC, Clang and MSVC.
+#
+# SMTG_PLUGIN_PGO selects the mode:
+#   OFF      : no PGO
+#   GENERATE : the plug-in is instrumented, the target <plug-in>_pgo_training runs the training
+#              and writes the profiles to SMTG_PLUGIN_PGO_DIR. The training runs the offline
+#              processing benchmark, with MSVC or without the benchmark the VST3 validator.
+#   USE      : the plug-in is optimized with the profiles in SMTG_PLUGIN_PGO_DIR
+#
+# Use the same build folder for both modes, GCC finds the profiles by the object file paths.
+
+set(SMTG_PGO_TRAINING_SCRIPT "${CMAKE_CURRENT_LIST_DIR}/SMTG_PGOTraining.cmake")
+
+# Compile and link options of the mode for the compiler in use, empty if not supported.
+function(smtg_get_pgo_options mode target profile_dir compile_var link_var)
+    set(compile_options "")
+    set(link_options "")
+    if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        if(mode STREQUAL "GENERATE")
+            # the audio processing runs in other threads than the controller
+            set(compile_options -fprofile-generate=${profile_dir} -fprofile-update=atomic)
+            set(link_options -fprofile-generate=${profile_dir})
+        else()
+            set(compile_options -fprofile-use=${profile_dir} -fprofile-correction -Wno-missing-profile)
+        endif()
+    elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang" AND NOT MSVC)
+        if(mode STREQUAL "GENERATE")
+            set(compile_options -fprofile-generate=${profile_dir})
+            set(link_options -fprofile-generate=${profile_dir})
+        else()
+            set(compile_options -fprofile-use=${profile_dir}/default.profdata
+                -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date
+            )
+            set(link_options -fprofile-use=${profile_dir}/default.profdata)
+        endif()
+    elseif(MSVC)
+        set(compile_options /GL)
+        if(mode STREQUAL "GENERATE")
+            set(link_options /LTCG /GENPROFILE:PGD=${profile_dir}/${target}.pgd)
+        else()
+            set(link_options /LTCG /USEPROFILE:PGD=${profile_dir}/${target}.pgd)
+        endif()
+    endif()
+    set(${compile_var} "${compile_options}" PARENT_SCOPE)
+    set(${link_var} "${link_options}" PARENT_SCOPE)
+endfunction(smtg_get_pgo_options)
+
+# The file which has to exist for the USE mode.
+function(smtg_get_pgo_profile_file target profile_dir out_var)
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang" AND NOT MSVC)
+        set(${out_var} "${profile_dir}/default.profdata" PARENT_SCOPE)
+    elseif(MSVC)
+        set(${out_var} "${profile_dir}/${target}.pgd" PARENT_SCOPE)
+    else()
+        set(${out_var} "${profile_dir}" PARENT_SCOPE)
+    endif()
+endfunction(smtg_get_pgo_profile_file)
+
+# Adds the target <target>_pgo_training which runs the training command with the instrumented
+# code. The command defaults to the VST3 validator, which processes audio with the plug-in in
+# various settings, the targets of $<TARGET_FILE:...> in the command are built first.
+function(smtg_target_add_pgo_training target profile_dir)
+    set(training_command ${ARGN})
+    # The MSVC profiles belong to the instrumented binary, only running the plug-in trains them.
+    if(MSVC)
+        set(training_command "")
+    endif()
+    set(training_depends "")
+    if(NOT training_command)
+        if(NOT TARGET validator)
+            message(WARNING "PGO: the VST3 validator is not available for the training, "
+                "turn on SMTG_ADD_VST3_HOSTING_SAMPLES and turn off SMTG_PLUGIN_USE_PREBUILT_SDK.")
+            return()
+        endif()
+        get_target_property(package_path ${target} SMTG_PLUGIN_PACKAGE_PATH)
+        set(training_command $<TARGET_FILE:validator> "${package_path}")
+    endif()
+    string(REGEX MATCHALL "\\$<TARGET_FILE:[^>]+>" target_files "${training_command}")
+    foreach(target_file ${target_files})
+        string(REGEX REPLACE "^\\$<TARGET_FILE:(.+)>$" "\\1" command_target "${target_file}")
+        list(APPEND training_depends ${command_target})
+    endforeach()
+
+    set(profdata "")
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang" AND NOT MSVC)
+        if(APPLE)
+            find_program(SMTG_LLVM_PROFDATA xcrun)
+            set(profdata ${SMTG_LLVM_PROFDATA} llvm-profdata)
+        else()
+            # Linux distributions suffix the LLVM tools with the major version
+            get_filename_component(compiler_dir "${CMAKE_CXX_COMPILER}" DIRECTORY)
+            string(REGEX MATCH "^[0-9]+" compiler_major "${CMAKE_CXX_COMPILER_VERSION}")
+            find_program(SMTG_LLVM_PROFDATA
+                NAMES llvm-profdata-${compiler_major} llvm-profdata
+                HINTS ${compiler_dir}
+            )
+            set(profdata ${SMTG_LLVM_PROFDATA})
+        endif()
+        if(NOT SMTG_LLVM_PROFDATA)
+            message(WARNING "PGO: llvm-profdata not found, the profiles can not be merged.")
+            return()
+        endif()
+    endif()
+
+    add_custom_target(${target}_pgo_training
+        COMMAND ${CMAKE_COMMAND}
+            "-DSMTG_PGO_PROFILE_DIR=${profile_dir}"
+            "-DSMTG_PGO_COMPILER_ID=${CMAKE_CXX_COMPILER_ID}"
+            "-DSMTG_PGO_PROFDATA=${profdata}"
+            "-DSMTG_PGO_TRAINING_COMMAND=${training_command}"
+            -P "${SMTG_PGO_TRAINING_SCRIPT}"
+        DEPENDS ${target} ${training_depends}
+        COMMENT "Training the PGO profiles of ${target}"
+        VERBATIM
+    )
+endfunction(smtg_target_add_pgo_training)
+
+# Sets up the mode for the target, the plug-in. The optional arguments are
+#   OBJECTS <object library>  : is instrumented as well and passes the link options to the
+#                               targets linking it, so a benchmark running the same objects
+#                               trains the profiles of the plug-in
+#   TRAINING_COMMAND <command>: replaces the validator for the training
+function(smtg_target_setup_pgo target mode profile_dir)
+    cmake_parse_arguments(PARSE_ARGV 3 pgo "" "OBJECTS" "TRAINING_COMMAND")
+    if(NOT mode OR mode STREQUAL "OFF")
+        return()
+    endif()
+    if(NOT mode MATCHES "^(GENERATE|USE)$")
+        message(FATAL_ERROR "Unknown PGO mode ${mode}, use OFF, GENERATE or USE.")
+    endif()
+
+    smtg_get_pgo_options(${mode} ${target} "${profile_dir}" compile_options link_options)
+    if(NOT compile_options)
+        message(WARNING "PGO: not supported for the ${CMAKE_CXX_COMPILER_ID} compiler.")
+        return()
+    endif()
+
+    if(mode STREQUAL "USE")
+        smtg_get_pgo_profile_file(${target} "${profile_dir}" profile_file)
+        if(NOT EXISTS "${profile_file}")
+            message(WARNING "PGO: ${profile_file} not found, build the target "
+                "${target}_pgo_training with SMTG_PLUGIN_PGO=GENERATE first.")
+            return()
+        endif()
+    endif()
+
+    file(MAKE_DIRECTORY "${profile_dir}")
+    target_compile_options(${target} PRIVATE ${compile_options})
+    target_link_options(${target} PRIVATE ${link_options})
+    if(pgo_OBJECTS)
+        target_compile_options(${pgo_OBJECTS} PRIVATE ${compile_options})
+        # the MSVC link options name the profile of the plug-in
+        if(NOT MSVC)
+            target_link_options(${pgo_OBJECTS} INTERFACE ${link_options})
+        endif()
+    endif()
+    message(STATUS "PGO: ${mode} with the profiles in ${profile_dir}")
+
+    if(mode STREQUAL "GENERATE")
+        smtg_target_add_pgo_training(${target} "${profile_dir}" ${pgo_TRAINING_COMMAND})
+    endif()
+endfunction(smtg_target_setup_pgo)
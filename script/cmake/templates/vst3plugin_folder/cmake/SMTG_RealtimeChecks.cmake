@@ -0,0 +1,73 @@
+cmake_minimum_required(VERSION 3.14.0)
+
+# Reports memory allocations, frees and mutex locks in the realtime scopes (process and
+# setProcessing) of Debug builds of the plug-in. The functions are wrapped with the GNU linker
+# option --wrap, which is only available on Linux.
+
+set(SMTG_REALTIME_CHECKED_SYMBOLS
+    malloc
+    calloc
+    realloc
+    free
+    posix_memalign
+    aligned_alloc
+    pthread_mutex_lock
+    pthread_mutex_trylock
+    pthread_rwlock_rdlock
+    pthread_rwlock_wrlock
+    pthread_rwlock_tryrdlock
+    pthread_rwlock_trywrlock
+    # operator new, new[], delete, delete[] and the sized deletes of 64 bit platforms
+    _Znwm
+    _Znam
+    _ZdlPv
+    _ZdaPv
+    _ZdlPvm
+    _ZdaPvm
+    # the nothrow variants
+    _ZnwmRKSt9nothrow_t
+    _ZnamRKSt9nothrow_t
+    _ZdlPvRKSt9nothrow_t
+    _ZdaPvRKSt9nothrow_t
+    # the aligned variants (C++17)
+    _ZnwmSt11align_val_t
+    _ZnamSt11align_val_t
+    _ZnwmSt11align_val_tRKSt9nothrow_t
+    _ZnamSt11align_val_tRKSt9nothrow_t
+    _ZdlPvSt11align_val_t
+    _ZdaPvSt11align_val_t
+    _ZdlPvmSt11align_val_t
+    _ZdaPvmSt11align_val_t
+)
+
+# Enables the realtime checks of the target's RealtimeScope in the Debug configuration.
+# With abort the first violation aborts the process, otherwise each violation is reported.
+# The target may be an object library, then the targets linking it are wrapped.
+function(smtg_target_enable_realtime_checks target abort)
+    if(NOT CMAKE_SYSTEM_NAME STREQUAL "Linux")
+        message(WARNING "Realtime checks need the GNU linker option --wrap and are only supported on Linux.")
+        return()
+    endif()
+    if(NOT CMAKE_SIZEOF_VOID_P EQUAL 8)
+        message(WARNING "Realtime checks are only supported on 64 bit platforms.")
+        return()
+    endif()
+    set(link_scope PRIVATE)
+    get_target_property(type ${target} TYPE)
+    if(type STREQUAL "OBJECT_LIBRARY")
+        set(link_scope INTERFACE)
+    endif()
+    foreach(symbol ${SMTG_REALTIME_CHECKED_SYMBOLS})
+        target_link_options(${target} ${link_scope} $<$<CONFIG:Debug>:-Wl,--wrap=${symbol}>)
+    endforeach()
+    target_compile_definitions(${target}
+        PRIVATE
+            $<$<CONFIG:Debug>:SMTG_PLUGIN_REALTIME_CHECKS>
+    )
+    if(abort)
+        target_compile_definitions(${target}
+            PRIVATE
+                $<$<CONFIG:Debug>:SMTG_PLUGIN_REALTIME_CHECKS_ABORT>
+        )
+    endif()
+endfunction(smtg_target_enable_realtime_checks)
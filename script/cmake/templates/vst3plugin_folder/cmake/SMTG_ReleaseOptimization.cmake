@@ -0,0 +1,102 @@
+cmake_minimum_required(VERSION 3.14.0)
+
+# Code generation settings for the production builds of the plug-in.
+
+include(CheckCXXCompilerFlag)
+include(CheckIPOSupported)
+
+# Call before adding the SDK: enables link time optimization (IPO) for the Release configuration
+# of all targets added afterwards, so the SDK libraries are optimized together with the plug-in.
+# The shared prebuilt SDK build (SMTG_PrebuiltVST3SDK.cmake) gets the setting as well.
+macro(smtg_enable_release_ipo)
+    check_ipo_supported(RESULT smtg_ipo_supported OUTPUT smtg_ipo_output LANGUAGES CXX)
+    if(smtg_ipo_supported)
+        set(CMAKE_INTERPROCEDURAL_OPTIMIZATION_RELEASE ON)
+        message(STATUS "Link time optimization: enabled for Release")
+    else()
+        message(STATUS "Link time optimization: not supported (${smtg_ipo_output})")
+    endif()
+endmacro(smtg_enable_release_ipo)
+
+# Adds the compile options if the compiler accepts them, otherwise prints a message.
+function(smtg_target_add_checked_compile_options target description)
+    string(MAKE_C_IDENTIFIER "SMTG_HAS_FLAG_${ARGN}" check_var)
+    string(REPLACE ";" " " flags "${ARGN}")
+    set(CMAKE_REQUIRED_QUIET ON)
+    check_cxx_compiler_flag("${flags}" ${check_var})
+    if(${check_var})
+        target_compile_options(${target} PRIVATE ${ARGN})
+        message(STATUS "${description}: ${flags}")
+    else()
+        message(STATUS "${description}: ${flags} is not supported by the compiler")
+    endif()
+endfunction(smtg_target_add_checked_compile_options)
+
+# Sets the minimum x86-64 instruction set of the target: DEFAULT, x86-64-v2 (SSE4.2, POPCNT) or
+# x86-64-v3 (AVX2, FMA, BMI2). The plug-in does not load on older processors than selected.
+# Other architectures are not affected, for universal macOS builds only the x86_64 part.
+function(smtg_target_set_instruction_set target isa)
+    if(NOT isa OR isa STREQUAL "DEFAULT")
+        return()
+    endif()
+    if(NOT isa MATCHES "^x86-64-v[23]$")
+        message(FATAL_ERROR "Unknown instruction set ${isa}, use DEFAULT, x86-64-v2 or x86-64-v3.")
+    endif()
+
+    set(prefix "")
+    if(APPLE AND CMAKE_OSX_ARCHITECTURES)
+        if(NOT "x86_64" IN_LIST CMAKE_OSX_ARCHITECTURES)
+            return()
+        endif()
+        list(LENGTH CMAKE_OSX_ARCHITECTURES num_architectures)
+        if(num_architectures GREATER 1)
+            set(prefix -Xarch_x86_64)
+        endif()
+    elseif(NOT CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64)$")
+        return()
+    endif()
+
+    if(MSVC)
+        # MSVC has no option for x86-64-v2, SSE4.2 is the closest
+        if(isa STREQUAL "x86-64-v2")
+            smtg_target_add_checked_compile_options(${target} "Instruction set" /arch:SSE4.2)
+        else()
+            smtg_target_add_checked_compile_options(${target} "Instruction set" /arch:AVX2)
+        endif()
+    else()
+        smtg_target_add_checked_compile_options(${target} "Instruction set" ${prefix} -march=${isa})
+    endif()
+endfunction(smtg_target_set_instruction_set)
+
+# Sets the floating point model of the target:
+#   PRECISE : value safe optimizations only (the compiler default)
+#   STRICT  : additionally no contraction of multiply and add into FMA instructions
+#   FAST    : fast math, but infinities and NaNs are still handled so that checks for them work
+# The options are only used for compiling. Linking with -ffast-math would set the
+# flush-to-zero mode for the whole host process when the plug-in is loaded.
+function(smtg_target_set_float_model target model)
+    if(NOT model)
+        set(model PRECISE)
+    endif()
+    if(MSVC)
+        if(model STREQUAL "PRECISE")
+            set(options /fp:precise)
+        elseif(model STREQUAL "STRICT")
+            set(options /fp:strict)
+        elseif(model STREQUAL "FAST")
+            set(options /fp:fast)
+        endif()
+    else()
+        if(model STREQUAL "PRECISE")
+            set(options -fno-fast-math)
+        elseif(model STREQUAL "STRICT")
+            set(options -fno-fast-math -ffp-contract=off)
+        elseif(model STREQUAL "FAST")
+            set(options -ffast-math -fno-finite-math-only)
+        endif()
+    endif()
+    if(NOT options)
+        message(FATAL_ERROR "Unknown floating point model ${model}, use PRECISE, STRICT or FAST.")
+    endif()
+    smtg_target_add_checked_compile_options(${target} "Floating point model" ${options})
+endfunction(smtg_target_set_float_model)